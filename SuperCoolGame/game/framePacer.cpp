@@ -0,0 +1,118 @@
+#include "framePacer.h"
+
+#include <SFML/System/Sleep.hpp>
+
+#include <algorithm>
+#include <thread>
+#include <cmath>
+
+namespace gm
+{
+	FramePacer::FramePacer(unsigned int framesPerSecond)
+	{
+		setFrameRate(framesPerSecond);
+
+		//start with a safe spin time until the sleeps have been measured
+		spinTime = std::chrono::milliseconds(2);
+	}
+
+	void FramePacer::setFrameRate(unsigned int framesPerSecond)
+	{
+		frameDuration = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / std::max(framesPerSecond, 1u)));
+		started = false;
+	}
+
+	void FramePacer::wait()
+	{
+		Clock::time_point now = Clock::now();
+
+		//the first frame just starts the timing
+		if (!started)
+		{
+			started = true;
+			lastFrame = now;
+			nextFrame = now + frameDuration;
+			return;
+		}
+
+		//sleep until the spin time is reached. Every sleep is measured to find out how late the OS wakes up.
+		while (nextFrame - now > spinTime)
+		{
+			//sf::sleep raises the timer resolution on Windows while sleeping. std::this_thread::sleep_for doesn't,
+			//so it would sleep in steps of about 15.6 ms there, which is longer than a whole frame at 120 Hz.
+			const Clock::duration sleepTime = nextFrame - now - spinTime;
+			sf::sleep(sf::microseconds(std::chrono::duration_cast<std::chrono::microseconds>(sleepTime).count()));
+
+			const Clock::time_point wokeUp = Clock::now();
+			addOversleep((wokeUp - now) - sleepTime);
+			now = wokeUp;
+		}
+
+		//spin for the rest of the time
+		while (now < nextFrame)
+		{
+			std::this_thread::yield();
+			now = Clock::now();
+		}
+
+		addFrameTime(now - lastFrame);
+		lastFrame = now;
+
+		//the next frame is based on when this frame should have started so small errors don't add up
+		nextFrame += frameDuration;
+
+		//if the game fell behind don't try to catch up with a bunch of short frames
+		if (now > nextFrame)
+			nextFrame = now + frameDuration;
+	}
+
+	void FramePacer::addOversleep(Clock::duration oversleep)
+	{
+		const double oversleepMs = std::chrono::duration<double, std::milli>(oversleep).count();
+
+		//exponential moving average of the mean and variance, so it adapts if the timing changes
+		constexpr double weight = 0.1;
+		const double difference = oversleepMs - oversleepMean;
+		oversleepMean += weight * difference;
+		oversleepVariance = (1.0 - weight) * (oversleepVariance + weight * difference * difference);
+
+		//spin long enough to cover almost every late wake up, but never the whole frame
+		const double spinMs = std::min(std::max(oversleepMean + 3.0 * std::sqrt(oversleepVariance), 0.1),
+			std::chrono::duration<double, std::milli>(frameDuration).count() * 0.5);
+
+		spinTime = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double, std::milli>(spinMs));
+		stats.spinTime = static_cast<float>(spinMs);
+	}
+
+	void FramePacer::addFrameTime(Clock::duration frameTime)
+	{
+		//store the frame time in the ring buffer
+		frameTimes[frameTimeIndex] = std::chrono::duration<float, std::milli>(frameTime).count();
+		frameTimeIndex = (frameTimeIndex + 1) % STATS_FRAME_COUNT;
+		frameTimeCount = std::min(frameTimeCount + 1, STATS_FRAME_COUNT);
+
+		//find the average, min and max
+		float total = 0.f;
+		stats.minFrameTime = frameTimes[0];
+		stats.maxFrameTime = frameTimes[0];
+		for (std::size_t i = 0; i < frameTimeCount; i++)
+		{
+			total += frameTimes[i];
+			stats.minFrameTime = std::min(stats.minFrameTime, frameTimes[i]);
+			stats.maxFrameTime = std::max(stats.maxFrameTime, frameTimes[i]);
+		}
+
+		stats.averageFrameTime = total / static_cast<float>(frameTimeCount);
+		stats.framesPerSecond = (stats.averageFrameTime > 0.f) ? 1000.f / stats.averageFrameTime : 0.f;
+
+		//find the standard deviation
+		float variance = 0.f;
+		for (std::size_t i = 0; i < frameTimeCount; i++)
+		{
+			const float difference = frameTimes[i] - stats.averageFrameTime;
+			variance += difference * difference;
+		}
+
+		stats.jitter = std::sqrt(variance / static_cast<float>(frameTimeCount));
+	}
+}
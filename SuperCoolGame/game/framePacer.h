@@ -0,0 +1,74 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+
+namespace gm
+{
+	//frame time statistics over the last few seconds. All times are in milliseconds.
+	struct FrameStats
+	{
+		float averageFrameTime = 0.f;
+		float minFrameTime = 0.f;
+		float maxFrameTime = 0.f;
+
+		//standard deviation of the frame times
+		float jitter = 0.f;
+
+		float framesPerSecond = 0.f;
+
+		//how long the pacer stops sleeping before the frame to spin instead
+		float spinTime = 0.f;
+	};
+
+	/*
+	* Keeps the frame rate steady. sf::Window::setFramerateLimit only sleeps, and the OS can wake up a few
+	* milliseconds late, which makes the frame times jump around. This sleeps until it is close to the next frame
+	* and then spins for the rest. How early it stops sleeping is based on how late the sleeps have been waking up.
+	*/
+	class FramePacer
+	{
+	public:
+		//number of frames used for the statistics
+		static constexpr std::size_t STATS_FRAME_COUNT = 120;
+
+		explicit FramePacer(unsigned int framesPerSecond = 60);
+
+		//changes the target frame rate
+		void setFrameRate(unsigned int framesPerSecond);
+
+		//waits until the next frame should start. Call this once every frame after displaying.
+		void wait();
+
+		//statistics of the last STATS_FRAME_COUNT frames
+		const FrameStats& getStats() const { return stats; }
+
+	private:
+		using Clock = std::chrono::steady_clock;
+
+		//adds the time the last frame took to the statistics
+		void addFrameTime(Clock::duration frameTime);
+
+		//adds how late a sleep woke up to the spin time estimate
+		void addOversleep(Clock::duration oversleep);
+
+		Clock::duration frameDuration;
+		Clock::time_point nextFrame;
+		Clock::time_point lastFrame;
+		bool started = false;
+
+		//sleeps stop this long before the next frame
+		Clock::duration spinTime;
+
+		//running average and variance of how late sleeps wake up in milliseconds
+		double oversleepMean = 1.0;
+		double oversleepVariance = 0.0;
+
+		//the last frame times in milliseconds
+		std::array<float, STATS_FRAME_COUNT> frameTimes{};
+		std::size_t frameTimeCount = 0;
+		std::size_t frameTimeIndex = 0;
+
+		FrameStats stats;
+	};
+}
@@ -23,6 +23,145 @@ namespace gm
 		nebulaTexture.loadFromFile("./assets/sprites/nebula.png");
 		enemyRocketshipTexture.loadFromFile("./assets/sprites/enemyRocket.png");
 		heartTexture.loadFromFile("./assets/sprites/heart.png");
+
+		//create the shared animation clips. The default one has to be first because objects use clip 0 unless they change it.
+		defaultAnimationClip = animationClips.size();
+		animationClips.push_back(AnimationClip::createStrip(3, 10));
+		nebulaAnimationClip = animationClips.size();
+		animationClips.push_back(AnimationClip::createStrip(4, 10));
+		stillAnimationClip = animationClips.size();
+		animationClips.push_back(AnimationClip::createStrip(1, 10));
+	}
+}
+
+//animation
+namespace gm
+{
+	AnimationClip AnimationClip::createStrip(unsigned int frameCount, unsigned int frameDuration, AnimationLoopMode loopMode, sf::Vector2i frameSize)
+	{
+		AnimationClip clip;
+		clip.loopMode = loopMode;
+
+		//a clip always needs at least one frame
+		frameCount = std::max(frameCount, 1u);
+
+		//add the frames from left to right
+		for (unsigned int i = 0; i < frameCount; i++)
+		{
+			clip.frames.push_back({ { static_cast<int>(i) * frameSize.x, 0 }, frameSize });
+			clip.frameDurations.push_back(frameDuration);
+		}
+
+		return clip;
+	}
+
+	void advanceAnimation(const AnimationClip& clip, Animation& animation)
+	{
+		//start again if the clip was changed to one with less frames
+		if (animation.frame >= clip.frames.size())
+		{
+			animation.frame = 0;
+			animation.timer = 0;
+		}
+
+		//nothing to animate
+		if (clip.frames.size() <= 1 || animation.finished)
+			return;
+
+		//check if the current frame should update
+		animation.timer += 1;
+		if (animation.timer < clip.frameDurations[animation.frame])
+			return;
+
+		animation.timer = 0;
+		const std::size_t lastFrame = clip.frames.size() - 1;
+
+		switch (clip.loopMode)
+		{
+		case AnimationLoopMode::Loop:
+			animation.frame = (animation.frame < lastFrame) ? animation.frame + 1 : 0;
+			break;
+
+		case AnimationLoopMode::Once:
+			if (animation.frame < lastFrame)
+				animation.frame += 1;
+			else
+				animation.finished = true;
+			break;
+
+		case AnimationLoopMode::PingPong:
+			//turn around at either end
+			if (animation.reverse && animation.frame == 0)
+				animation.reverse = false;
+			else if (!animation.reverse && animation.frame == lastFrame)
+				animation.reverse = true;
+
+			animation.frame = animation.reverse ? animation.frame - 1 : animation.frame + 1;
+			break;
+		}
+	}
+}
+
+//sprite batching
+namespace gm
+{
+	void SpriteBatch::clear()
+	{
+		for (std::size_t i = 0; i < layerCount; i++)
+			layers[i].vertices.clear();
+
+		layerCount = 0;
+	}
+
+	void SpriteBatch::add(const sf::Texture* texture, const sf::Transform& transform, const sf::IntRect& textureRect, const sf::Color& color)
+	{
+		//sprites without a texture aren't drawn
+		if (!texture)
+			return;
+
+		//continue the last layer if it has the same texture, otherwise start a new one so the sprite is drawn on top
+		if (layerCount == 0 || layers[layerCount - 1].texture != texture)
+		{
+			if (layerCount == layers.size())
+				layers.push_back({});
+
+			layers[layerCount].texture = texture;
+			layerCount++;
+		}
+
+		Layer* layer = &layers[layerCount - 1];
+
+		//the corners of the quad, the same way sf::Sprite makes them
+		const float width = static_cast<float>(std::abs(textureRect.width));
+		const float height = static_cast<float>(std::abs(textureRect.height));
+
+		const float left = static_cast<float>(textureRect.left);
+		const float right = left + static_cast<float>(textureRect.width);
+		const float top = static_cast<float>(textureRect.top);
+		const float bottom = top + static_cast<float>(textureRect.height);
+
+		const sf::Vertex topLeft{ transform.transformPoint(0.f, 0.f), color, { left, top } };
+		const sf::Vertex topRight{ transform.transformPoint(width, 0.f), color, { right, top } };
+		const sf::Vertex bottomLeft{ transform.transformPoint(0.f, height), color, { left, bottom } };
+		const sf::Vertex bottomRight{ transform.transformPoint(width, height), color, { right, bottom } };
+
+		//two triangles for the quad
+		layer->vertices.push_back(topLeft);
+		layer->vertices.push_back(bottomLeft);
+		layer->vertices.push_back(topRight);
+		layer->vertices.push_back(topRight);
+		layer->vertices.push_back(bottomLeft);
+		layer->vertices.push_back(bottomRight);
+	}
+
+	void SpriteBatch::draw(sf::RenderTarget& target, sf::RenderStates states) const
+	{
+		//one draw call for each run of sprites with the same texture
+		for (std::size_t i = 0; i < layerCount; i++)
+		{
+			states.texture = layers[i].texture;
+			target.draw(layers[i].vertices.data(), layers[i].vertices.size(), sf::Triangles, states);
+		}
 	}
 }
 
@@ -56,12 +195,8 @@ namespace gm {
 	void entityMovementCalculations(const float& deltaTime, std::vector<Entity*>&entities)
 	{
 		//perform calculations on all entities
-		for (auto& entity : entities)
+		for (Entity* entity : entities)
 		{
-			//check if the entity exists
-			if (!entity)
-				continue;
-
 			//check if gravity should be applied
 			if (entity->gravityEnabled)
 				entity->acceleration.y += 10.f;
@@ -130,12 +265,8 @@ namespace gm {
 	void projectileMovementCalculations(const float& deltaTime, std::vector<Projectile*>&projectiles)
 	{
 		//calculate projectile movement
-		for (auto& projectile : projectiles)
+		for (Projectile* projectile : projectiles)
 		{
-			//check if the projectile exists
-			if (!projectile)
-				continue;
-
 			//apply acceleration
 			projectile->velocity += projectile->acceleration * deltaTime;
 
@@ -168,20 +299,20 @@ namespace gm
 	void entityCollisionCheck(std::vector<Entity*>& entities)
 	{
 		//loop over all entites
-		for (auto& entityA : entities)
+		for (Entity* entityA : entities)
 		{
-			//check if they exist and if they have collision enabled
-			if (!entityA || !entityA->collisionEnabled)
+			//check if they are alive and if they have collision enabled
+			if (entityA->dead || !entityA->collisionEnabled)
 				continue;
 
 			//create their collision rectangle
 			sf::FloatRect rectA{ entityA->position + entityA->velocity, entityA->size };
 
 			//loop over all entities
-			for (auto& entityB : entities)
+			for (Entity* entityB : entities)
 			{
-				//check if they exist and if the entity has the same id as entity A
-				if (!entityB || entityA == entityB)
+				//check if they are alive and if the entity is the same as entity A
+				if (entityB->dead || entityA == entityB)
 					continue;
 
 				//check if entity A is checking that collision layer
@@ -232,10 +363,10 @@ namespace gm
 	void staticCollisionCheck(std::vector<StaticBody*>& staticBodies, std::vector<Entity*>& entities)
 	{
 		//loop over all entites
-		for (auto& entity : entities)
+		for (Entity* entity : entities)
 		{
-			//check if they exist
-			if (!entity)
+			//check if they are alive
+			if (entity->dead)
 				continue;
 
 			//create their collision rectangle
@@ -244,10 +375,6 @@ namespace gm
 			//loop over static bodies
 			for (auto& staticBody : staticBodies)
 			{
-				//check if the entity exists again. Can't remember why :P 
-				if (!entity)
-					continue;
-					
 				//check if the entity is checking that collision layer
 				if (entity->collisionLayerToCheck != staticBody->collisionLayer)
 					continue;
@@ -300,39 +427,25 @@ namespace gm
 
 	void projectileCollisionCheck(gm::GameData& gameData, std::vector<Projectile*>& projectiles, std::vector<Entity*>& entities)
 	{
-		//get the window size and make it slightly bigger so the projectiles can spawn of screen
-		sf::FloatRect windowRect{ {-50.f, -50.f}, sf::Vector2f{conf::WINDOW_WIDTH, conf::WINDOW_HEIGHT} + sf::Vector2f{100.f, 100.f}};
-
-		//loop over the projectiles
-		for (auto& projectile : projectiles)
+		//loop over the projectiles. Projectiles that leave the screen are removed by cullObjects.
+		for (Projectile* projectile : projectiles)
 		{
-			//check if the projectile exist
-			if (!projectile)
+			//check if the projectile was destroyed earlier this frame
+			if (projectile->dead)
 				continue;
 
 			//get the projectile collision rect
 			sf::FloatRect projectileRect{ projectile->position + projectile->velocity, projectile->size };
 
-			//if there was a collision with the window remove it
-			if (!windowRect.intersects(projectileRect))
-			{
-				projectile = nullptr;
-				continue;
-			}
-
 			/*
 			* Check if the projectile is not a health pick up. This is done so the player bullets don't destroy the 
 			* health. A better solution would have been found if it weren't for time constraints.
 			*/
 			if (projectile->group != "healthPickUp")
-				for (auto& projectileB : projectiles)
+				for (Projectile* projectileB : projectiles)
 				{
-					//check if the projectile exists
-					if (!projectile)
-						break;
-
-					//check if projectile B exists and if the projectiles are the same
-					if (!projectileB || projectile == projectileB)
+					//check if projectile B is alive and if the projectiles are the same
+					if (projectileB->dead || projectile == projectileB)
 						continue;
 
 					//check if the projectile is checking the layer projectile B is on
@@ -374,7 +487,7 @@ namespace gm
 
 					//check if the projectile should be destroyed
 					if (projectile->hp <= 0)
-						projectile = nullptr;
+						projectile->dead = true;
 
 					//check if there is a collision callback
 					if (projectileB->collisionCallback)
@@ -384,20 +497,20 @@ namespace gm
 
 					//check if the projectile should be destroyed
 					if (projectileB->hp <= 0)
-						projectileB = nullptr;
+						projectileB->dead = true;
 
 					break;
 				}
 
 			//loop over entites
-			for (auto& entity : entities)
+			for (Entity* entity : entities)
 			{
-				//check if the projectile still exists
-				if (!projectile)
+				//check if the projectile is still alive
+				if (projectile->dead)
 					break;
 
-				//check if the entity still exists
-				if (!entity)
+				//check if the entity is still alive
+				if (entity->dead)
 					continue;
 
 				//check if the projectile should check the entity layer
@@ -429,11 +542,11 @@ namespace gm
 
 				//destroy the projectile if enabled
 				if (projectile->dissapearOnHit && projectile->takeDamage)
-					projectile = nullptr;
+					projectile->dead = true;
 
 				//destroy the entity on zero hp
 				if (entity->hp <= 0)
-					entity = nullptr;
+					entity->dead = true;
 
 				break;
 			}
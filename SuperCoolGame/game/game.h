@@ -1,6 +1,8 @@
 #pragma once
 
 #include "vectorMath.h"
+#include "spawnDirector.h"
+#include "swarm.h"
 #include "SFML/Graphics.hpp"
 #include "SFML/Audio.hpp"
 
@@ -16,12 +18,15 @@ namespace conf
 	constexpr float WINDOW_WIDTH = 400.f;
 	constexpr float WINDOW_HEIGHT = 200.f;
 
+	constexpr unsigned int FRAME_RATE = 60;
+
 	constexpr float PLAYER_MOVEMENT_SPEED = 100.f;
 	constexpr float PLAYER_DASH_SPEED = 500.f;
 	constexpr float PLAYER_BULLET_SPEED = 5.f;
 	constexpr float ENEMY_ROCKET_SHIP_SPEED = 2.f;
 	constexpr float ENEMY_MOVEMENT_SPEED = 0.5f;
 	constexpr float NEBULA_MOVEMENT_SPEED = 0.1f;
+	constexpr float SWARM_MOVEMENT_SPEED = 1.2f;
 }
 
 namespace gm
@@ -29,6 +34,51 @@ namespace gm
 	class GameData; //information on this class further down in file ;)
 }
 
+//animation
+namespace gm
+{
+	//controls what happens when an animation reaches its last frame
+	enum class AnimationLoopMode
+	{
+		Loop,		//start again from the first frame
+		Once,		//stop on the last frame
+		PingPong	//play backwards to the first frame and then forwards again
+	};
+
+	//an animation that is shared between objects. Objects only store the index of the clip in gameData.animationClips.
+	struct AnimationClip
+	{
+		//the texture rect of every frame
+		std::vector<sf::IntRect> frames;
+
+		//the number of game frames each animation frame is shown for. Needs one for every frame.
+		std::vector<unsigned int> frameDurations;
+
+		AnimationLoopMode loopMode = AnimationLoopMode::Loop;
+
+		//creates a clip from a row of frames that are next to each other in the texture
+		static AnimationClip createStrip(unsigned int frameCount, unsigned int frameDuration,
+			AnimationLoopMode loopMode = AnimationLoopMode::Loop, sf::Vector2i frameSize = { 16, 16 });
+	};
+
+	//the animation state of an object
+	struct Animation
+	{
+		//index of the clip in gameData.animationClips
+		std::size_t clip = 0;
+
+		//current frame of the clip and how long it has been shown for
+		std::size_t frame = 0;
+		unsigned int timer = 0;
+
+		//used by ping pong clips when playing backwards
+		bool reverse = false;
+
+		//set when a clip that plays once has reached the end
+		bool finished = false;
+	};
+}
+
 //Game Objects
 namespace gm
 {
@@ -50,14 +100,8 @@ namespace gm
 		//Offsets the texture of the sprite
 		sf::Vector2f textureOffset;
 
-		//controls the number of frames between each animation frame
-		unsigned int timeBetweenAnimationFrames = 10;
-
-		/*
-		* controls the length of the animation(This is in pixels not frames).
-		* ie. 3 16x16 images will have a length of 48.
-		*/
-		unsigned int animationLength = 32;
+		//the animation of the sprite. Uses the default clip unless another one is set.
+		Animation animation;
 
 		//size and position of collision rect
 		sf::Vector2f position, size;
@@ -74,6 +118,9 @@ namespace gm
 		//the object will only check for collisions with other objects that are on the same layer. Zero means it is a part of all layers
 		unsigned int collisionLayerToCheck = 0;
 
+		//set when the object is destroyed. It gets removed by cullObjects at the start of the next frame.
+		bool dead = false;
+
 		Base() = default;
 		Base(const sf::Vector2f position, const sf::Vector2f size, const sf::Color color) : position(position), size(size), color(color) {};
 	};
@@ -151,6 +198,105 @@ namespace gm
 	};
 }
 
+//lifecycle
+namespace gm
+{
+	//the areas that the game objects are sorted into every frame
+	struct CullingBounds
+	{
+		//objects that leave this are removed. It is bigger then the window so objects can spawn off screen.
+		sf::FloatRect despawnBounds{ { -50.f, -50.f }, { conf::WINDOW_WIDTH + 100.f, conf::WINDOW_HEIGHT + 100.f } };
+
+		//objects inside of this are drawn, run their processes and collide
+		sf::FloatRect visibleBounds{ { 0.f, 0.f }, { conf::WINDOW_WIDTH, conf::WINDOW_HEIGHT } };
+
+		//sprites can be bigger then the collision rect, so this much is added around objects when checking if they are visible
+		float visibleMargin = 16.f;
+	};
+
+	//compact lists of the objects in a vector of type T. They are made once per frame by cullObjects.
+	template<typename T>
+	struct ActiveLists
+	{
+		//objects that are alive and inside of the despawn bounds. These still move.
+		std::vector<T*> active;
+
+		//active objects that are also inside of the visible bounds
+		std::vector<T*> visible;
+	};
+
+	/*
+	* Removes dead objects and objects outside of the despawn bounds from the vector of type T, and sorts the
+	* rest into the active and visible lists. This is the only place objects are removed, so everything else
+	* can loop over the lists without checking for empty slots.
+	*/
+	template<typename T>
+	void cullObjects(const CullingBounds& bounds, std::vector<T*>& objects, ActiveLists<T>& lists)
+	{
+		lists.active.clear();
+		lists.visible.clear();
+
+		for (auto& object : objects)
+		{
+			if (!object)
+				continue;
+
+			//remove dead objects and objects that are too far off screen
+			const sf::FloatRect rect{ object->position + object->velocity, object->size };
+			if (object->dead || !bounds.despawnBounds.intersects(rect))
+			{
+				object = nullptr;
+				continue;
+			}
+
+			lists.active.push_back(object);
+
+			//check if the object can be seen
+			const sf::FloatRect visibleRect{
+				rect.left - bounds.visibleMargin,
+				rect.top - bounds.visibleMargin,
+				rect.width + bounds.visibleMargin * 2.f,
+				rect.height + bounds.visibleMargin * 2.f
+			};
+
+			if (bounds.visibleBounds.intersects(visibleRect))
+				lists.visible.push_back(object);
+		}
+	}
+}
+
+//sprite batching
+namespace gm
+{
+	/*
+	* Collects the sprites of a frame so they can be drawn with one draw call per texture instead of
+	* one per sprite. Sprites are drawn in the order they were added, so only sprites that are added
+	* right after each other with the same texture share a draw call.
+	*/
+	class SpriteBatch : public sf::Drawable
+	{
+	public:
+		//removes all sprites but keeps the memory for the next frame
+		void clear();
+
+		//adds a quad with the texture rect, transformed by the transform
+		void add(const sf::Texture* texture, const sf::Transform& transform, const sf::IntRect& textureRect, const sf::Color& color);
+
+	private:
+		void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+
+		struct Layer
+		{
+			const sf::Texture* texture = nullptr;
+			std::vector<sf::Vertex> vertices;
+		};
+
+		//the layers are kept between frames to reuse their memory, only the first layerCount are used
+		std::vector<Layer> layers;
+		std::size_t layerCount = 0;
+	};
+}
+
 //The gameData stores any important data that needs to be accessed. 
 namespace gm
 {
@@ -186,6 +332,17 @@ namespace gm
 		std::vector<Entity*> entities;
 		std::vector<StaticBody*> staticBodies;
 		std::vector<Projectile*> projectiles;
+
+		//the game objects that are active and visible this frame
+		CullingBounds cullingBounds;
+		ActiveLists<Entity> activeEntities;
+		ActiveLists<Projectile> activeProjectiles;
+
+		//spawns the enemies and pick ups from the wave table
+		SpawnDirector spawnDirector;
+
+		//steers the homing swarm enemies towards the player
+		Swarm swarm{ { conf::WINDOW_WIDTH, conf::WINDOW_HEIGHT } };
 		
 		//stores loaded sound effects and also stores music
 		sf::SoundBuffer shootingSoundBuffer;
@@ -206,6 +363,15 @@ namespace gm
 		sf::Texture enemyRocketshipTexture;
 		sf::Texture heartTexture;
 
+		//stores the animation clips that are shared by the objects
+		std::vector<AnimationClip> animationClips;
+		std::size_t defaultAnimationClip = 0;
+		std::size_t nebulaAnimationClip = 0;
+		std::size_t stillAnimationClip = 0;
+
+		//the sprites of the game objects for this frame
+		SpriteBatch spriteBatch;
+
 		GameData();
 	};
 }
@@ -229,9 +395,9 @@ namespace gm
 	void drawRectList(R& texture, const std::vector<T*>& entities)
 	{
 		static sf::RectangleShape rect;
-		for (const auto& entity : entities)
+		for (const T* entity : entities)
 		{
-			if (!entity)
+			if (entity->dead)
 				continue;
 
 			rect.setPosition(entity->position);
@@ -240,58 +406,44 @@ namespace gm
 			texture.draw(rect);
 		}
 	}
+}
 
-	//Draw the sprite of type T to type R.
-	template<typename R, typename T>
-	void drawSprite(const unsigned long long& frame, R& texture, T& entity)
-	{
-		//apply sprite offset
-		entity.sprite.setPosition(entity.position - entity.textureOffset);
-
-		//get sprite rect for animating
-		sf::IntRect entityRect = entity.sprite.getTextureRect();
-
-		//check if the current frame should update.
-		if (frame % entity.timeBetweenAnimationFrames == 0)
-		{
-			//update the current frame and loop to 0 if it is outside of the animation length
-			entityRect.left += 16;
-			if (entityRect.left > entity.animationLength)
-				entityRect.left = 0;
-		}
-
-		//draw the sprite
-		entity.sprite.setTextureRect(entityRect);
-		texture.draw(entity.sprite);
-	}
+//animation
+namespace gm
+{
+	//advances the animation by one game frame
+	void advanceAnimation(const AnimationClip& clip, Animation& animation);
 
-	//Draw the sprite list of type T to type R.
-	template<typename R, typename T>
-	void drawSpriteList(const unsigned long long& frame, R& texture, std::vector<T*>& entities)
+	/*
+	* Advances the animations of the list of type T and adds their sprites to the batch. This is called
+	* once per frame, so drawing the batch afterwards doesn't change any of the objects.
+	*/
+	template<typename T>
+	void animateSpriteList(const std::vector<AnimationClip>& clips, const std::vector<T*>& objects, SpriteBatch& batch)
 	{
-		for (auto& entity : entities)
+		for (T* object : objects)
 		{
-			if (!entity)
+			//skip objects that were destroyed this frame
+			if (object->dead)
 				continue;
 
-			//apply sprite offset
-			entity->sprite.setPosition(entity->position - entity->textureOffset);
+			//get the clip and skip objects without frames
+			const AnimationClip& clip = clips[object->animation.clip];
+			if (clip.frames.empty())
+				continue;
 
-			//get sprite rect for animating
-			sf::IntRect entityRect = entity->sprite.getTextureRect();
+			advanceAnimation(clip, object->animation);
 
-			//check if the current frame should update.
-			if (frame % entity->timeBetweenAnimationFrames == 0)
-			{
-				//update the current frame and loop to 0 if it is outside of the animation length
-				entityRect.left += 16;
-				if (entityRect.left > static_cast<int>(entity->animationLength))
-					entityRect.left = 0;
-			}
+			//place the sprite at the object with the texture offset applied
+			const sf::Sprite& sprite = object->sprite;
+			sf::Transform transform;
+			transform.translate(object->position - object->textureOffset)
+				.rotate(sprite.getRotation())
+				.scale(sprite.getScale())
+				.translate(-sprite.getOrigin());
 
-			//draw the sprite
-			entity->sprite.setTextureRect(entityRect);
-			texture.draw(entity->sprite);
+			//write the current frame into the batch
+			batch.add(sprite.getTexture(), transform, clip.frames[object->animation.frame], sprite.getColor());
 		}
 	}
 }
@@ -320,9 +472,29 @@ namespace gm
 		vector.push_back(element);
 		return static_cast<std::size_t>(vector.size() - 1);
 	}
+
+	/*
+	* adds a list of type T to a vector of type T in a single pass. Empty locations are filled first and the
+	* rest is added to the back. This is much faster then calling addToVector for every element.
+	*/
+	template<typename T>
+	void addListToVector(std::vector<T*>& vector, const std::vector<T*>& elements)
+	{
+		std::size_t next = 0;
+
+		//fill the empty locations
+		for (std::size_t i = 0; i < vector.size() && next < elements.size(); i++)
+		{
+			if (!vector[i])
+				vector[i] = elements[next++];
+		}
+
+		//add whatever is left to the back of the vector
+		vector.insert(vector.end(), elements.begin() + static_cast<std::ptrdiff_t>(next), elements.end());
+	}
 }
 
-//object movements and processes
+//object movements and processes. These loop over the lists from cullObjects, so they don't have empty slots.
 namespace gm
 {
 	//calculates the entities movement
@@ -335,10 +507,10 @@ namespace gm
 	void executeProcesses(GameData& gameData, std::vector<T*>& objects)
 	{
 		//loop over the objects. 
-		for (auto& object : objects)
+		for (T* object : objects)
 		{
-			//make sure the objects exist and have a process
-			if (!object || !object->processCallback)
+			//make sure the objects are alive and have a process
+			if (object->dead || !object->processCallback)
 				continue;
 
 			//execute process
@@ -356,6 +528,7 @@ namespace gm
 	/*
 	* collison for the three different objects.I would have found a more elagant approach, where
 	* I only need one function, but I ran out of time.
+	* The entities and projectiles are the lists from cullObjects. Destroyed objects are marked as dead.
 	*/
 	void entityCollisionCheck(std::vector<Entity*>& entities);
 	void staticCollisionCheck(std::vector<StaticBody*>& staticBodies, std::vector<Entity*>& entities);
@@ -0,0 +1,325 @@
+#include "spawnDirector.h"
+#include "game.h"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+#include <cmath>
+
+//timer wheel
+namespace gm
+{
+	void TimerWheel::reset(unsigned long long tick)
+	{
+		//remove all timers but keep the memory of the slots
+		for (auto& level : levels)
+			for (auto& slot : level)
+				slot.clear();
+
+		overflow.clear();
+		currentTick = tick;
+	}
+
+	void TimerWheel::schedule(unsigned long long dueTick, std::uint32_t id)
+	{
+		//timers in the past expire on the next tick
+		if (dueTick < currentTick)
+			dueTick = currentTick;
+
+		const unsigned long long delta = dueTick - currentTick;
+
+		//find the lowest level that can hold the timer
+		for (unsigned int level = 0; level < LEVEL_COUNT; level++)
+		{
+			if (delta < (1ull << (SLOT_BITS * (level + 1))))
+			{
+				levels[level][(dueTick >> (SLOT_BITS * level)) & (SLOT_COUNT - 1)].push_back({ dueTick, id });
+				return;
+			}
+		}
+
+		//the timer is too far away for the wheel
+		overflow.push_back({ dueTick, id });
+	}
+
+	void TimerWheel::cascade(unsigned int level)
+	{
+		//swap the slot out so timers can be put back into the wheel while looping over them
+		cascading.swap(levels[level][(currentTick >> (SLOT_BITS * level)) & (SLOT_COUNT - 1)]);
+
+		for (const Timer& timer : cascading)
+			schedule(timer.dueTick, timer.id);
+
+		cascading.clear();
+	}
+
+	void TimerWheel::advance(std::vector<std::uint32_t>& expired)
+	{
+		//put the overflow back in when the top level wraps around
+		if ((currentTick & ((1ull << (SLOT_BITS * LEVEL_COUNT)) - 1)) == 0 && !overflow.empty())
+		{
+			cascading.swap(overflow);
+
+			for (const Timer& timer : cascading)
+				schedule(timer.dueTick, timer.id);
+
+			cascading.clear();
+		}
+
+		//move timers down from the higher levels, starting at the top so they can fall all the way down
+		for (unsigned int level = LEVEL_COUNT - 1; level > 0; level--)
+		{
+			if ((currentTick & ((1ull << (SLOT_BITS * level)) - 1)) == 0)
+				cascade(level);
+		}
+
+		//every timer in the current slot expires on this tick
+		std::vector<Timer>& slot = levels[0][currentTick & (SLOT_COUNT - 1)];
+		for (const Timer& timer : slot)
+			expired.push_back(timer.id);
+
+		slot.clear();
+		currentTick += 1;
+	}
+}
+
+//spawn director
+namespace gm
+{
+	SpawnDirector::SpawnDirector()
+		: generator(std::random_device{}())
+	{
+	}
+
+	void SpawnDirector::addPattern(const std::string& name, SpawnCallback callback)
+	{
+		patternNames.push_back(name);
+		patternCallbacks.push_back(callback);
+		patternSpawnCounts.push_back(0);
+	}
+
+	bool SpawnDirector::loadFromFile(const std::string& path)
+	{
+		std::ifstream file{ path };
+		if (!file)
+			return false;
+
+		rules.clear();
+
+		//the wave that the patterns are being added to
+		bool inWave = false;
+		unsigned long long waveStartScore = 0;
+		unsigned long long waveEndScore = 0;
+
+		std::string line;
+		unsigned int lineNumber = 0;
+		while (std::getline(file, line))
+		{
+			lineNumber += 1;
+
+			//remove comments
+			std::istringstream stream{ line.substr(0, line.find('#')) };
+
+			//skip empty lines
+			std::string word;
+			if (!(stream >> word))
+				continue;
+
+			//start a new wave
+			if (word == "wave")
+			{
+				if (!(stream >> waveStartScore))
+				{
+					printf("Missing wave start score on line %u of %s\n", lineNumber, path.c_str());
+					inWave = false;
+					continue;
+				}
+
+				if (!(stream >> waveEndScore))
+					waveEndScore = 0;
+
+				inWave = true;
+				continue;
+			}
+
+			//patterns have to be inside of a wave
+			if (!inWave)
+			{
+				printf("Spawn pattern outside of a wave on line %u of %s\n", lineNumber, path.c_str());
+				continue;
+			}
+
+			//find the pattern
+			const auto patternIt = std::find(patternNames.begin(), patternNames.end(), word);
+			if (patternIt == patternNames.end())
+			{
+				printf("Unknown spawn pattern \"%s\" on line %u of %s\n", word.c_str(), lineNumber, path.c_str());
+				continue;
+			}
+
+			SpawnRule rule;
+			rule.pattern = static_cast<std::size_t>(patternIt - patternNames.begin());
+			rule.startScore = waveStartScore;
+			rule.endScore = waveEndScore;
+
+			//the period and chance are needed
+			if (!(stream >> rule.period >> rule.chance))
+			{
+				printf("Missing period or chance on line %u of %s\n", lineNumber, path.c_str());
+				continue;
+			}
+
+			//a period of zero would spawn forever on the same frame
+			if (rule.period == 0)
+				rule.period = 1;
+
+			//the burst and curve are optional
+			if (!(stream >> rule.burst))
+				rule.burst = 1;
+
+			std::string curve;
+			if (stream >> curve)
+			{
+				if (curve == "linear")
+					rule.curve = SpawnCurve::Linear;
+				else if (curve == "exponential")
+					rule.curve = SpawnCurve::Exponential;
+				else if (curve != "constant")
+					printf("Unknown spawn curve \"%s\" on line %u of %s\n", curve.c_str(), lineNumber, path.c_str());
+
+				if (rule.curve != SpawnCurve::Constant && !(stream >> rule.curveAmount))
+					rule.curveAmount = 0.f;
+			}
+
+			rules.push_back(rule);
+		}
+
+		//sort the rules so they can be started in order of score
+		std::stable_sort(rules.begin(), rules.end(), [](const SpawnRule& a, const SpawnRule& b) {
+			return a.startScore < b.startScore;
+		});
+
+		reset(timerWheel.getTick());
+		return true;
+	}
+
+	void SpawnDirector::reset(unsigned long long frame)
+	{
+		timerWheel.reset(frame);
+		nextRule = 0;
+
+		for (auto& rule : rules)
+		{
+			rule.active = false;
+			rule.spawnOnNextTimer = false;
+		}
+	}
+
+	float SpawnDirector::getChance(const SpawnRule& rule, unsigned long long score) const
+	{
+		//the curves are based on how far the score is into the wave
+		const float progress = static_cast<float>(score - std::min(score, rule.startScore)) / 100.f;
+
+		float chance = rule.chance;
+		if (rule.curve == SpawnCurve::Linear)
+			chance *= 1.f + rule.curveAmount * progress;
+		else if (rule.curve == SpawnCurve::Exponential)
+			chance *= std::pow(1.f + rule.curveAmount, progress);
+
+		return std::min(std::max(chance, 0.f), 1.f);
+	}
+
+	void SpawnDirector::scheduleRule(std::uint32_t ruleIndex, unsigned long long score)
+	{
+		SpawnRule& rule = rules[ruleIndex];
+
+		//spawns can only happen on multiples of the period, the same way frame % period == 0 worked
+		const unsigned long long frame = timerWheel.getTick();
+		const unsigned long long firstFrame = ((frame + rule.period - 1) / rule.period) * rule.period;
+
+		/*
+		* instead of rolling the chance every period, find how many periods will fail before the next
+		* spawn. This is the same as rolling every period but only needs one timer per spawn.
+		*/
+		const float chance = getChance(rule, score);
+		unsigned long long missedPeriods = 0;
+
+		if (chance <= 0.f)
+		{
+			//nothing can spawn right now, so check again next period in case the curve changes
+			rule.spawnOnNextTimer = false;
+		}
+		else
+		{
+			if (chance < 1.f)
+			{
+				std::geometric_distribution<unsigned long long> missedDistribution{ static_cast<double>(chance) };
+				missedPeriods = std::min(missedDistribution(generator), 1ull << 32);
+			}
+
+			rule.spawnOnNextTimer = true;
+		}
+
+		timerWheel.schedule(firstFrame + missedPeriods * rule.period, ruleIndex);
+	}
+
+	void SpawnDirector::update(GameData& gameData)
+	{
+		const unsigned long long score = gameData.score;
+
+		//start the waves that the score has reached
+		while (nextRule < rules.size() && rules[nextRule].startScore <= score)
+		{
+			rules[nextRule].active = true;
+			scheduleRule(static_cast<std::uint32_t>(nextRule), score);
+			nextRule += 1;
+		}
+
+		//find the rules that spawn on this frame
+		expiredRules.clear();
+		timerWheel.advance(expiredRules);
+
+		if (expiredRules.empty())
+			return;
+
+		//add up the spawns of every pattern so they can be created together
+		std::fill(patternSpawnCounts.begin(), patternSpawnCounts.end(), 0u);
+
+		for (const std::uint32_t ruleIndex : expiredRules)
+		{
+			SpawnRule& rule = rules[ruleIndex];
+
+			if (!rule.active)
+				continue;
+
+			//stop the rule if the score has passed the end of its wave
+			if (rule.endScore != 0 && score >= rule.endScore)
+			{
+				rule.active = false;
+				continue;
+			}
+
+			if (rule.spawnOnNextTimer)
+				patternSpawnCounts[rule.pattern] += rule.burst;
+
+			scheduleRule(ruleIndex, score);
+		}
+
+		//create all of the spawns
+		spawned.clear();
+		for (std::size_t pattern = 0; pattern < patternCallbacks.size(); pattern++)
+		{
+			for (unsigned int i = 0; i < patternSpawnCounts[pattern]; i++)
+			{
+				Projectile* projectile = patternCallbacks[pattern](gameData, generator);
+
+				if (projectile)
+					spawned.push_back(projectile);
+			}
+		}
+
+		//add them to the projectiles in one pass
+		addListToVector(gameData.projectiles, spawned);
+	}
+}
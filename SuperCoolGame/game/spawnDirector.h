@@ -0,0 +1,155 @@
+#pragma once
+
+#include <array>
+#include <vector>
+#include <string>
+#include <random>
+#include <cstdint>
+
+namespace gm
+{
+	class GameData;
+	class Projectile;
+}
+
+//timer wheel
+namespace gm
+{
+	/*
+	* A hierarchical timer wheel. Timers are put into a slot based on how far away they are, so scheduling
+	* and expiring a timer is O(1) no matter how many are waiting. Each level has 64 slots and each level
+	* covers 64 times more ticks then the one below it. When the lower level wraps around, the matching
+	* slot of the level above is moved down ("cascaded").
+	*/
+	class TimerWheel
+	{
+	public:
+		static constexpr unsigned int SLOT_BITS = 6;
+		static constexpr unsigned int SLOT_COUNT = 1u << SLOT_BITS;
+		static constexpr unsigned int LEVEL_COUNT = 4;
+
+		//clears all timers and sets the next tick that will be processed
+		void reset(unsigned long long tick = 0);
+
+		//adds a timer that expires on the due tick. Timers in the past expire on the next tick.
+		void schedule(unsigned long long dueTick, std::uint32_t id);
+
+		//processes the current tick, adds the ids of all expired timers to the list and moves to the next tick.
+		void advance(std::vector<std::uint32_t>& expired);
+
+		//the next tick that will be processed
+		unsigned long long getTick() const { return currentTick; }
+
+	private:
+		struct Timer
+		{
+			unsigned long long dueTick;
+			std::uint32_t id;
+		};
+
+		//moves all timers of a slot back into the wheel so they land on a lower level
+		void cascade(unsigned int level);
+
+		std::array<std::array<std::vector<Timer>, SLOT_COUNT>, LEVEL_COUNT> levels;
+
+		//timers that are too far away for the wheel. They are put back in every time the top level wraps.
+		std::vector<Timer> overflow;
+
+		//used while cascading so the slot can keep its memory
+		std::vector<Timer> cascading;
+
+		unsigned long long currentTick = 0;
+	};
+}
+
+//spawn director
+namespace gm
+{
+	//controls how the spawn chance of a pattern grows as the score goes up from the start of its wave
+	enum class SpawnCurve
+	{
+		Constant,
+		Linear,
+		Exponential
+	};
+
+	//a spawn pattern inside of a wave
+	struct SpawnRule
+	{
+		std::size_t pattern = 0;
+
+		//the rule is only active while the score is in [startScore, endScore). An end score of 0 never ends.
+		unsigned long long startScore = 0;
+		unsigned long long endScore = 0;
+
+		//number of frames between each spawn chance
+		unsigned long long period = 10;
+
+		//chance of spawning every period and the number of objects spawned when it does
+		float chance = 0.1f;
+		unsigned int burst = 1;
+
+		//how the chance scales with the score. The amount is per 100 score.
+		SpawnCurve curve = SpawnCurve::Constant;
+		float curveAmount = 0.f;
+
+		//used while the game is running
+		bool active = false;
+		bool spawnOnNextTimer = false;
+	};
+
+	/*
+	* Spawns the enemies and pick ups. The waves are loaded from a file and each pattern in a wave schedules
+	* its next spawn in a timer wheel, so nothing is checked on the frames where nothing spawns. Every spawn
+	* that happens on the same frame is created and added to the projectiles in one go.
+	*/
+	class SpawnDirector
+	{
+	public:
+		//creates one object of a spawn pattern. Returning nullptr skips the spawn.
+		using SpawnCallback = Projectile* (*)(GameData& gameData, std::mt19937& generator);
+
+		SpawnDirector();
+
+		//patterns have to be added before the waves are loaded so the names can be found
+		void addPattern(const std::string& name, SpawnCallback callback);
+
+		/*
+		* loads the wave table. Returns false if the file could not be opened.
+		* The file looks like this:
+		*	wave <startScore> [endScore]
+		*	<pattern> <period> <chance> [burst [constant | linear <amount> | exponential <amount>]]
+		*/
+		bool loadFromFile(const std::string& path);
+
+		//stops all waves so the game can start again from the given frame
+		void reset(unsigned long long frame = 0);
+
+		//starts waves that the score reached and spawns everything that is due this frame. Call once per frame.
+		void update(GameData& gameData);
+
+	private:
+		//finds the chance of a rule at the current score
+		float getChance(const SpawnRule& rule, unsigned long long score) const;
+
+		//puts the next spawn of a rule in the timer wheel
+		void scheduleRule(std::uint32_t ruleIndex, unsigned long long score);
+
+		std::vector<std::string> patternNames;
+		std::vector<SpawnCallback> patternCallbacks;
+
+		//sorted by start score so the waves can be started in order
+		std::vector<SpawnRule> rules;
+		std::size_t nextRule = 0;
+
+		TimerWheel timerWheel;
+
+		//reused every frame so spawning doesn't allocate
+		std::vector<std::uint32_t> expiredRules;
+		std::vector<unsigned int> patternSpawnCounts;
+		std::vector<Projectile*> spawned;
+
+		//only seeded once instead of every spawn
+		std::mt19937 generator;
+	};
+}
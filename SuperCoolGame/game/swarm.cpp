@@ -0,0 +1,476 @@
+#include "swarm.h"
+#include "game.h"
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <cstdio>
+#include <cmath>
+
+//flow field
+namespace gm
+{
+	namespace
+	{
+		constexpr std::uint32_t UNREACHED = std::numeric_limits<std::uint32_t>::max();
+
+		//cost of moving to a neighbor cell. Diagonals cost about sqrt(2) times as much.
+		constexpr std::uint32_t STRAIGHT_COST = 10;
+		constexpr std::uint32_t DIAGONAL_COST = 14;
+	}
+
+	FlowField::FlowField(const sf::Vector2f& fieldSize, float fieldCellSize)
+		: cellSize(std::max(fieldCellSize, 1.f)),
+		columns(std::max(1, static_cast<int>(std::ceil(fieldSize.x / cellSize)))),
+		rows(std::max(1, static_cast<int>(std::ceil(fieldSize.y / cellSize))))
+	{
+		const std::size_t cellCount = static_cast<std::size_t>(columns) * static_cast<std::size_t>(rows);
+		blocked.assign(cellCount, false);
+		costs.assign(cellCount, UNREACHED);
+		directions.assign(cellCount, { 0.f, 0.f });
+	}
+
+	std::size_t FlowField::getCellIndex(const sf::Vector2f& position) const
+	{
+		const int x = std::min(std::max(static_cast<int>(std::floor(position.x / cellSize)), 0), columns - 1);
+		const int y = std::min(std::max(static_cast<int>(std::floor(position.y / cellSize)), 0), rows - 1);
+		return static_cast<std::size_t>(y) * static_cast<std::size_t>(columns) + static_cast<std::size_t>(x);
+	}
+
+	void FlowField::setBlocked(const sf::FloatRect& rect, bool isBlocked)
+	{
+		const std::size_t topLeft = getCellIndex({ rect.left, rect.top });
+		const std::size_t bottomRight = getCellIndex({ rect.left + rect.width, rect.top + rect.height });
+
+		for (std::size_t y = topLeft / columns; y <= bottomRight / columns; y++)
+			for (std::size_t x = topLeft % columns; x <= bottomRight % columns; x++)
+				blocked[y * columns + x] = isBlocked;
+
+		//the old paths might go through the changed cells
+		pendingTargetCell = getCellIndex(target);
+		targetChanged = true;
+	}
+
+	void FlowField::setTarget(const sf::Vector2f& newTarget)
+	{
+		target = newTarget;
+
+		//find the target cell of the newest search
+		std::size_t latestTargetCell = targetCell;
+		if (targetChanged)
+			latestTargetCell = pendingTargetCell;
+		else if (searching)
+			latestTargetCell = searchTargetCell;
+
+		//only search again if the target moved into another cell, or if nothing was searched yet
+		const std::size_t cell = getCellIndex(newTarget);
+		if (cell != latestTargetCell || (searchCount == 0 && !searching))
+		{
+			pendingTargetCell = cell;
+			targetChanged = true;
+		}
+	}
+
+	void FlowField::startSearch(std::size_t newTargetCell)
+	{
+		std::fill(costs.begin(), costs.end(), UNREACHED);
+
+		while (!openCells.empty())
+			openCells.pop();
+
+		costs[newTargetCell] = 0;
+		openCells.push({ 0, static_cast<std::uint32_t>(newTargetCell) });
+
+		searchTargetCell = newTargetCell;
+		searching = true;
+	}
+
+	void FlowField::update(std::size_t cellBudget)
+	{
+		//start the next search once the last one is finished, so a moving target can't stop it from ever finishing
+		if (!searching)
+		{
+			if (!targetChanged)
+				return;
+
+			startSearch(pendingTargetCell);
+			targetChanged = false;
+		}
+
+		//dijkstra search outwards from the target, only doing part of it every frame
+		std::size_t processedCells = 0;
+		while (!openCells.empty() && processedCells < cellBudget)
+		{
+			const QueuedCell current = openCells.top();
+			openCells.pop();
+
+			//skip cells that were already reached with a lower cost
+			if (current.cost > costs[current.cell])
+				continue;
+
+			processedCells += 1;
+
+			const int x = static_cast<int>(current.cell) % columns;
+			const int y = static_cast<int>(current.cell) / columns;
+
+			for (int offsetY = -1; offsetY <= 1; offsetY++)
+			{
+				for (int offsetX = -1; offsetX <= 1; offsetX++)
+				{
+					const int neighborX = x + offsetX;
+					const int neighborY = y + offsetY;
+
+					if ((offsetX == 0 && offsetY == 0) || neighborX < 0 || neighborY < 0 || neighborX >= columns || neighborY >= rows)
+						continue;
+
+					const std::size_t neighbor = static_cast<std::size_t>(neighborY * columns + neighborX);
+					if (blocked[neighbor])
+						continue;
+
+					//don't cut the corners of blocked cells
+					const bool diagonal = offsetX != 0 && offsetY != 0;
+					if (diagonal && (blocked[y * columns + neighborX] || blocked[neighborY * columns + x]))
+						continue;
+
+					const std::uint32_t cost = current.cost + (diagonal ? DIAGONAL_COST : STRAIGHT_COST);
+					if (cost < costs[neighbor])
+					{
+						costs[neighbor] = cost;
+						openCells.push({ cost, static_cast<std::uint32_t>(neighbor) });
+					}
+				}
+			}
+		}
+
+		if (openCells.empty())
+			finishSearch();
+	}
+
+	void FlowField::finishSearch()
+	{
+		//point every cell at its cheapest neighbor
+		for (int y = 0; y < rows; y++)
+		{
+			for (int x = 0; x < columns; x++)
+			{
+				const std::size_t cell = static_cast<std::size_t>(y * columns + x);
+				directions[cell] = { 0.f, 0.f };
+
+				if (blocked[cell] || costs[cell] == UNREACHED)
+					continue;
+
+				std::uint32_t lowestCost = costs[cell];
+				for (int offsetY = -1; offsetY <= 1; offsetY++)
+				{
+					for (int offsetX = -1; offsetX <= 1; offsetX++)
+					{
+						const int neighborX = x + offsetX;
+						const int neighborY = y + offsetY;
+
+						if ((offsetX == 0 && offsetY == 0) || neighborX < 0 || neighborY < 0 || neighborX >= columns || neighborY >= rows)
+							continue;
+
+						const bool diagonal = offsetX != 0 && offsetY != 0;
+						if (diagonal && (blocked[y * columns + neighborX] || blocked[neighborY * columns + x]))
+							continue;
+
+						const std::uint32_t cost = costs[neighborY * columns + neighborX];
+						if (cost < lowestCost)
+						{
+							lowestCost = cost;
+							directions[cell] = normalize(sf::Vector2f{ static_cast<float>(offsetX), static_cast<float>(offsetY) });
+						}
+					}
+				}
+			}
+		}
+
+		targetCell = searchTargetCell;
+		searching = false;
+		searchCount += 1;
+	}
+
+	sf::Vector2f FlowField::getDirection(const sf::Vector2f& position) const
+	{
+		const std::size_t cell = getCellIndex(position);
+
+		//go straight to the target once in its cell or if the cell has no path
+		if (cell == targetCell || (directions[cell].x == 0.f && directions[cell].y == 0.f))
+			return normalize(target - position);
+
+		return directions[cell];
+	}
+}
+
+//worker pool
+namespace gm
+{
+	WorkerPool::WorkerPool(unsigned int threadCount)
+	{
+		threads.reserve(threadCount);
+		for (unsigned int i = 0; i < threadCount; i++)
+			threads.emplace_back(&WorkerPool::work, this);
+	}
+
+	WorkerPool::~WorkerPool()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			stopping = true;
+		}
+
+		workAvailable.notify_all();
+		for (auto& thread : threads)
+			thread.join();
+	}
+
+	void WorkerPool::run(std::size_t count, const std::function<void(std::size_t)>& function)
+	{
+		if (count == 0)
+			return;
+
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			task = &function;
+			taskCount = count;
+			nextTask = 0;
+			busyThreads = threads.size();
+			generation++;
+		}
+
+		workAvailable.notify_all();
+
+		//help instead of waiting
+		runTasks();
+
+		std::unique_lock<std::mutex> lock(mutex);
+		workFinished.wait(lock, [this] { return busyThreads == 0; });
+		task = nullptr;
+	}
+
+	void WorkerPool::work()
+	{
+		unsigned long long finishedGeneration = 0;
+		while (true)
+		{
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+				workAvailable.wait(lock, [&] { return stopping || generation != finishedGeneration; });
+				if (stopping)
+					return;
+
+				finishedGeneration = generation;
+			}
+
+			runTasks();
+
+			std::lock_guard<std::mutex> lock(mutex);
+			if (--busyThreads == 0)
+				workFinished.notify_one();
+		}
+	}
+
+	void WorkerPool::runTasks()
+	{
+		//the work was set up before the threads were woken up, so it can be read without the lock
+		for (std::size_t index = nextTask++; index < taskCount; index = nextTask++)
+			(*task)(index);
+	}
+}
+
+//swarm
+namespace gm
+{
+	Swarm::Swarm(const sf::Vector2f& swarmAreaSize, float flowCellSize)
+		: flowField(swarmAreaSize, flowCellSize),
+		workers(std::make_unique<WorkerPool>(std::max(std::thread::hardware_concurrency(), 1u) - 1)),
+		areaSize(swarmAreaSize)
+	{
+	}
+
+	void Swarm::step(const sf::Vector2f& target, const std::vector<Projectile*>& projectiles)
+	{
+		//find the agents
+		agents.clear();
+		for (Projectile* projectile : projectiles)
+		{
+			if (projectile && projectile->group == agentGroup)
+				agents.push_back(projectile);
+		}
+
+		//keep the flow field up to date even without agents so it is ready when they spawn
+		flowField.setTarget(target);
+		flowField.update(settings.flowCellBudget);
+
+		if (agents.empty())
+			return;
+
+		buildNeighborGrid();
+
+		//small swarms aren't worth waking up the threads
+		const std::size_t chunkSize = std::max<std::size_t>(settings.chunkSize, 1);
+		if (agents.size() <= chunkSize)
+		{
+			steerAgents(0, agents.size());
+			return;
+		}
+
+		//every agent only writes to itself, so the chunks can run at the same time
+		const std::size_t chunkCount = (agents.size() + chunkSize - 1) / chunkSize;
+		workers->run(chunkCount, [this, chunkSize](std::size_t chunk) {
+			steerAgents(chunk * chunkSize, std::min((chunk + 1) * chunkSize, agents.size()));
+		});
+	}
+
+	void Swarm::buildNeighborGrid()
+	{
+		//cells are as big as the separation radius, so only the 3x3 cells around an agent need to be checked
+		neighborCellSize = std::max(settings.separationRadius, 1.f);
+		neighborColumns = std::max(1, static_cast<int>(std::ceil(areaSize.x / neighborCellSize)));
+		neighborRows = std::max(1, static_cast<int>(std::ceil(areaSize.y / neighborCellSize)));
+
+		const std::size_t cellCount = static_cast<std::size_t>(neighborColumns) * static_cast<std::size_t>(neighborRows);
+		cellStarts.assign(cellCount + 1, 0);
+		agentCells.resize(agents.size());
+		agentSlots.resize(agents.size());
+		cellPositions.resize(agents.size());
+
+		//count the agents in each cell. Agents outside of the area go in the closest cell.
+		for (std::size_t i = 0; i < agents.size(); i++)
+		{
+			const int x = std::min(std::max(static_cast<int>(std::floor(agents[i]->position.x / neighborCellSize)), 0), neighborColumns - 1);
+			const int y = std::min(std::max(static_cast<int>(std::floor(agents[i]->position.y / neighborCellSize)), 0), neighborRows - 1);
+
+			agentCells[i] = static_cast<std::uint32_t>(y * neighborColumns + x);
+			cellStarts[agentCells[i]] += 1;
+		}
+
+		//turn the counts into the end of each cell
+		for (std::size_t cell = 1; cell < cellCount; cell++)
+			cellStarts[cell] += cellStarts[cell - 1];
+
+		cellStarts[cellCount] = static_cast<std::uint32_t>(agents.size());
+
+		//fill the cells from the back, which leaves every cell start pointing at the first agent of the cell
+		for (std::size_t i = 0; i < agents.size(); i++)
+		{
+			agentSlots[i] = --cellStarts[agentCells[i]];
+			cellPositions[agentSlots[i]] = agents[i]->position;
+		}
+	}
+
+	void Swarm::steerAgents(std::size_t first, std::size_t last)
+	{
+		const float radiusSquared = settings.separationRadius * settings.separationRadius;
+
+		for (std::size_t i = first; i < last; i++)
+		{
+			Projectile* agent = agents[i];
+			const sf::Vector2f position = agent->position;
+
+			//follow the flow field
+			const sf::Vector2f desiredVelocity = flowField.getDirection(position) * settings.maxSpeed;
+
+			//push away from close neighbors
+			sf::Vector2f separation{ 0.f, 0.f };
+			unsigned int neighborCount = 0;
+
+			const int cellX = static_cast<int>(agentCells[i]) % neighborColumns;
+			const int cellY = static_cast<int>(agentCells[i]) / neighborColumns;
+
+			for (int y = std::max(cellY - 1, 0); y <= std::min(cellY + 1, neighborRows - 1) && neighborCount < settings.maxNeighbors; y++)
+			{
+				for (int x = std::max(cellX - 1, 0); x <= std::min(cellX + 1, neighborColumns - 1) && neighborCount < settings.maxNeighbors; x++)
+				{
+					const std::size_t cell = static_cast<std::size_t>(y * neighborColumns + x);
+
+					for (std::uint32_t j = cellStarts[cell]; j < cellStarts[cell + 1] && neighborCount < settings.maxNeighbors; j++)
+					{
+						if (j == agentSlots[i])
+							continue;
+
+						//every neighbor that is looked at counts, so a big pile of agents can't make this slow
+						neighborCount += 1;
+
+						sf::Vector2f offset = position - cellPositions[j];
+						float distanceSquared = offset.x * offset.x + offset.y * offset.y;
+
+						if (distanceSquared >= radiusSquared)
+							continue;
+
+						//agents on top of each other get pushed in a direction based on their index
+						if (distanceSquared <= 0.f)
+						{
+							offset = { (i & 1) ? 0.1f : -0.1f, (i & 2) ? 0.1f : -0.1f };
+							distanceSquared = 0.02f;
+						}
+
+						//closer neighbors push harder
+						separation += offset * (settings.separationRadius / distanceSquared);
+					}
+				}
+			}
+
+			//steer towards the desired velocity without turning too fast
+			sf::Vector2f steering = desiredVelocity + separation * (settings.separationWeight * settings.maxSpeed) - agent->velocity;
+			const float steeringMagnitude = getMagnitude(steering);
+			if (steeringMagnitude > settings.maxForce)
+				steering *= settings.maxForce / steeringMagnitude;
+
+			sf::Vector2f velocity = agent->velocity + steering;
+			const float speed = getMagnitude(velocity);
+			if (speed > settings.maxSpeed)
+				velocity *= settings.maxSpeed / speed;
+
+			agent->velocity = velocity;
+
+			//face the direction the agent is moving. The sprite points to the left.
+			if (speed > 0.f)
+				agent->sprite.setRotation(std::atan2(velocity.y, velocity.x) * 180.f / 3.14159265f + 180.f);
+		}
+	}
+
+	void runSwarmBenchmark(std::size_t agentCount, unsigned int steps)
+	{
+		const sf::Vector2f areaSize{ conf::WINDOW_WIDTH, conf::WINDOW_HEIGHT };
+		Swarm swarm{ areaSize };
+
+		//fixed seed so every run is the same
+		std::mt19937 generator{ 1 };
+		std::uniform_real_distribution<float> xDistribution{ 0.f, areaSize.x };
+		std::uniform_real_distribution<float> yDistribution{ 0.f, areaSize.y };
+
+		//create the agents
+		std::vector<Projectile> agentStorage(agentCount);
+		std::vector<Projectile*> agents;
+		agents.reserve(agentCount);
+		for (auto& agent : agentStorage)
+		{
+			agent.group = swarm.agentGroup;
+			agent.position = { xDistribution(generator), yDistribution(generator) };
+			agents.push_back(&agent);
+		}
+
+		//the target moves in a circle so the flow field keeps being searched again
+		const auto getTarget = [&areaSize](unsigned int step) {
+			const float angle = static_cast<float>(step) * 0.02f;
+			return areaSize * 0.5f + sf::Vector2f{ std::cos(angle) * areaSize.x * 0.4f, std::sin(angle) * areaSize.y * 0.4f };
+		};
+
+		const auto start = std::chrono::steady_clock::now();
+
+		for (unsigned int step = 0; step < steps; step++)
+		{
+			swarm.step(getTarget(step), agents);
+			projectileMovementCalculations(1.f / 60.f, agents);
+		}
+
+		const double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		const double stepMs = (steps > 0) ? elapsedMs / steps : 0.0;
+
+		printf("Swarm benchmark: %zu agents, %u steps\n", agentCount, steps);
+		printf("  total: %.2f ms, per step: %.3f ms, per agent: %.1f ns\n", elapsedMs, stepMs,
+			(agentCount > 0) ? stepMs * 1000000.0 / static_cast<double>(agentCount) : 0.0);
+		printf("  flow field searches finished: %llu\n", swarm.getFlowField().getSearchCount());
+	}
+}
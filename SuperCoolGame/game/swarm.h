@@ -0,0 +1,216 @@
+#pragma once
+
+#include "SFML/System/Vector2.hpp"
+#include "SFML/Graphics/Rect.hpp"
+
+#include <condition_variable>
+#include <functional>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <vector>
+#include <string>
+#include <queue>
+#include <cstdint>
+
+namespace gm
+{
+	class Projectile;
+}
+
+//flow field
+namespace gm
+{
+	/*
+	* A coarse grid over the playfield where every cell points towards the shortest path to the target.
+	* Any number of agents can follow it by looking up their cell, so path finding doesn't depend on the
+	* number of agents. The search runs a few cells at a time over multiple frames and the old field is
+	* used until the new one is finished.
+	*/
+	class FlowField
+	{
+	public:
+		FlowField(const sf::Vector2f& fieldSize, float fieldCellSize);
+
+		//blocks or unblocks the cells under the rect. The field is searched again after this.
+		void setBlocked(const sf::FloatRect& rect, bool blocked);
+
+		//sets the position the field leads to. A new search starts once the target moves into another cell.
+		void setTarget(const sf::Vector2f& target);
+
+		//continues the search by up to cellBudget cells
+		void update(std::size_t cellBudget);
+
+		//the direction to move in from the position. It is a unit vector or zero.
+		sf::Vector2f getDirection(const sf::Vector2f& position) const;
+
+		//true while a search is still running
+		bool isSearching() const { return searching; }
+
+		//number of times the search has finished
+		unsigned long long getSearchCount() const { return searchCount; }
+
+	private:
+		//finds the cell of a position. Positions outside of the grid use the closest cell.
+		std::size_t getCellIndex(const sf::Vector2f& position) const;
+
+		//starts a search towards the target cell
+		void startSearch(std::size_t targetCell);
+
+		//turns the costs of the search into directions and starts using them
+		void finishSearch();
+
+		struct QueuedCell
+		{
+			std::uint32_t cost;
+			std::uint32_t cell;
+
+			bool operator>(const QueuedCell& other) const { return cost > other.cost; }
+		};
+
+		float cellSize;
+		int columns;
+		int rows;
+
+		std::vector<bool> blocked;
+
+		//the search that is running
+		std::vector<std::uint32_t> costs;
+		std::priority_queue<QueuedCell, std::vector<QueuedCell>, std::greater<QueuedCell>> openCells;
+		std::size_t searchTargetCell = 0;
+		bool searching = false;
+
+		//the target that has to be searched once the current search is done
+		std::size_t pendingTargetCell = 0;
+		bool targetChanged = false;
+
+		//the directions of the last finished search
+		std::vector<sf::Vector2f> directions;
+		std::size_t targetCell = 0;
+		sf::Vector2f target;
+		unsigned long long searchCount = 0;
+	};
+}
+
+//swarm
+namespace gm
+{
+	//controls how the swarm moves. Speeds are in pixels per frame.
+	struct SwarmSettings
+	{
+		float maxSpeed = 1.2f;
+
+		//how much the velocity can change each frame
+		float maxForce = 0.08f;
+
+		//agents closer then this push each other away
+		float separationRadius = 8.f;
+		float separationWeight = 1.5f;
+
+		//limits the number of neighbors looked at per agent so crowded agents don't get slower
+		unsigned int maxNeighbors = 16;
+
+		//number of flow field cells searched every frame
+		std::size_t flowCellBudget = 256;
+
+		//agents are steered in chunks of this size on different threads
+		std::size_t chunkSize = 1024;
+	};
+
+	/*
+	* Threads that are started once and then wait for work, so running work on them doesn't have to
+	* create new threads every frame. The thread that hands out the work helps with it until it is done.
+	*/
+	class WorkerPool
+	{
+	public:
+		//starts the threads. Without threads all work runs on the calling thread.
+		explicit WorkerPool(unsigned int threadCount);
+
+		//stops the threads after they finished their current work
+		~WorkerPool();
+
+		WorkerPool(const WorkerPool&) = delete;
+		WorkerPool& operator=(const WorkerPool&) = delete;
+
+		//calls the task for every index below taskCount, spread over the threads, and waits until all of them are done
+		void run(std::size_t count, const std::function<void(std::size_t)>& function);
+
+		std::size_t getThreadCount() const { return threads.size(); }
+
+	private:
+		//what every thread does until the pool is destroyed
+		void work();
+
+		//takes tasks of the current work until there are none left
+		void runTasks();
+
+		std::vector<std::thread> threads;
+
+		std::mutex mutex;
+		std::condition_variable workAvailable;
+		std::condition_variable workFinished;
+
+		//the current work. The generation changes every time new work is handed out.
+		const std::function<void(std::size_t)>* task = nullptr;
+		std::size_t taskCount = 0;
+		std::atomic<std::size_t> nextTask{ 0 };
+		std::size_t busyThreads = 0;
+		unsigned long long generation = 0;
+		bool stopping = false;
+	};
+
+	/*
+	* Homing enemies that follow a flow field towards the player and keep away from each other. Neighbors
+	* are found with a grid that is rebuilt every frame, so the cost of steering grows linearly with the
+	* number of agents. The steering of big swarms is split into chunks that run at the same time on
+	* threads that are created together with the swarm.
+	*/
+	class Swarm
+	{
+	public:
+		Swarm(const sf::Vector2f& swarmAreaSize, float flowCellSize = 10.f);
+
+		SwarmSettings settings;
+
+		//projectiles in this group are steered by the swarm
+		std::string agentGroup = "swarm";
+
+		//steers every agent in the projectiles towards the target by setting their velocity
+		void step(const sf::Vector2f& target, const std::vector<Projectile*>& projectiles);
+
+		FlowField& getFlowField() { return flowField; }
+
+		//number of agents that were steered in the last step
+		std::size_t getAgentCount() const { return agents.size(); }
+
+	private:
+		//puts the agents into the neighbor grid
+		void buildNeighborGrid();
+
+		//steers the agents from first to last
+		void steerAgents(std::size_t first, std::size_t last);
+
+		FlowField flowField;
+
+		//steers the chunks of big swarms. It is a pointer so the swarm can still be moved.
+		std::unique_ptr<WorkerPool> workers;
+
+		//the agents of this step
+		std::vector<Projectile*> agents;
+
+		//neighbor grid. Cells store a range of cellPositions and every agent knows its cell and slot in it.
+		sf::Vector2f areaSize;
+		float neighborCellSize = 0.f;
+		int neighborColumns = 0;
+		int neighborRows = 0;
+		std::vector<std::uint32_t> cellStarts;
+		std::vector<std::uint32_t> agentCells;
+		std::vector<std::uint32_t> agentSlots;
+		std::vector<sf::Vector2f> cellPositions;
+	};
+
+	//steps the agent count in a swarm without a window and prints how long it took
+	void runSwarmBenchmark(std::size_t agentCount, unsigned int steps);
+}
@@ -4,6 +4,7 @@
 //Use WASD or arrow keys to move. Space or Left Click to shoot.
 
 #include "./game/game.h"
+#include "./game/framePacer.h"
 #include "TGUI/TGUI.hpp"
 #include "TGUI/Backend/SFML-Graphics.hpp"
 #include "SFML/Audio.hpp"
@@ -93,6 +94,9 @@ static void initGame(gm::GameData& gameData)
 	gameData.player.collisionCallback = &playerCollisonReaction;
 	gameData.player.hp = 5;
 	gameData.entities.push_back(&gameData.player);
+
+	//start the waves from the beginning
+	gameData.spawnDirector.reset(gameData.frame);
 }
 
 //check for any window inputs
@@ -179,49 +183,52 @@ static void shootPlayerProjectile(gm::GameData& gameData)
 	}
 }
 
-//spawn rocket ships
-static void spawnEnemyRocketShips(gm::GameData& gameData, const bool fromRight, int spawnRate = 2)
+//creates a rocket ship
+static gm::Projectile* createEnemyRocketShip(const gm::GameData& gameData, std::mt19937& generator, const bool fromRight)
 {
-	//has a 50% chance to spawn a rocket every 20 frame 
-	if (gameData.frame % 20 == 0 && rand() % spawnRate == 1)
+	//random number generator for speed and position
+	std::uniform_real_distribution<float> speedDistribution{ 1.f, 2.f };
+	std::uniform_int_distribution<int> positionDistribution{ 0, 280 };
+
+	//get random y coordinate
+	const int y = positionDistribution(generator);
+
+	//create the rocket
+	gm::Projectile*  rocket = new gm::Projectile{
+		{(fromRight) ? conf::WINDOW_WIDTH + 20.f : -20.f, static_cast<float>(y)},
+		{10.f, 10.f},
+		sf::Color::Cyan
+	};
+	
+	//change the movement direction if the player is moving from the left
+	if (!fromRight)
 	{
-		//used to generate random numbers
-		std::random_device rd;
-		std::mt19937 generator{ rd() };
+		rocket->sprite.setRotation(180.f);
+		rocket->textureOffset = { -11.f, -11.f };
+	}
 
-		//random number generator for speed and position
-		std::uniform_real_distribution<float> speedDistribution{ 1.f, 2.f };
-		std::uniform_int_distribution<int> positionDistribution{ 0, 280 };
+	//assign rocket attributes
+	rocket->group = "rocketship";
+	rocket->sprite.setTexture(gameData.enemyRocketshipTexture);
+	rocket->sprite.setTextureRect(gameData.defaultTextureRect);
+	rocket->velocity = sf::Vector2f{ (fromRight) ? - 1.f : 1.f, 0} *conf::ENEMY_ROCKET_SHIP_SPEED * speedDistribution(generator);
+	rocket->friction = { 1.f, 1.f };
+	rocket->hp = 1;
+	rocket->collisionLayer = 1;
 
-		//get random y coordinate
-		const int y = positionDistribution(generator);
+	return rocket;
+}
 
-		//create the rocket
-		gm::Projectile*  rocket = new gm::Projectile{
-			{(fromRight) ? conf::WINDOW_WIDTH + 20.f : -20.f, static_cast<float>(y)},
-			{10.f, 10.f},
-			sf::Color::Cyan
-		};
-		
-		//change the movement direction if the player is moving from the left
-		if (!fromRight)
-		{
-			rocket->sprite.setRotation(180.f);
-			rocket->textureOffset = { -11.f, -11.f };
-		}
+//spawn pattern for rockets coming from the right
+static gm::Projectile* spawnEnemyRocketShipFromRight(gm::GameData& gameData, std::mt19937& generator)
+{
+	return createEnemyRocketShip(gameData, generator, true);
+}
 
-		//add the rocket to the projectile vector
-		std::size_t i = gm::addToVector(gameData.projectiles, rocket);
-
-		//assign rocket attributes
-		gameData.projectiles[i]->group = "rocketship";
-		gameData.projectiles[i]->sprite.setTexture(gameData.enemyRocketshipTexture);
-		gameData.projectiles[i]->sprite.setTextureRect(gameData.defaultTextureRect);
-		gameData.projectiles[i]->velocity = sf::Vector2f{ (fromRight) ? - 1.f : 1.f, 0} *conf::ENEMY_ROCKET_SHIP_SPEED * speedDistribution(generator);
-		gameData.projectiles[i]->friction = { 1.f, 1.f };
-		gameData.projectiles[i]->hp = 1;
-		gameData.projectiles[i]->collisionLayer = 1;
-	}
+//spawn pattern for rockets coming from the left
+static gm::Projectile* spawnEnemyRocketShipFromLeft(gm::GameData& gameData, std::mt19937& generator)
+{
+	return createEnemyRocketShip(gameData, generator, false);
 }
 
 //the asteroids process is called every frame. Controls the size of the asteroid relative to health. 
@@ -246,50 +253,41 @@ static void asteroidCallback(gm::GameData& gameData, gm::Base* self)
 	asteroid->lastSize = asteroid->size;
 }
 
-//spawns an asteroid 
-static void spawnAsteroids(gm::GameData& gameData, int spawnRates = 10)
+//spawn pattern for asteroids
+static gm::Projectile* spawnAsteroid(gm::GameData& gameData, std::mt19937& generator)
 {
-	//has a 1 / spawnRates change of spawning an asteroid every 10 frames
-	if (gameData.frame % 10 == 0 && rand() % spawnRates == 1)
-	{
-		//used to generate random numbers
-		std::random_device rd;
-		std::mt19937 generator{ rd() };
+	//create random number distributions for size, speed and position
+	std::uniform_real_distribution<float> sizeDistribution{ 30.f, 50.f };
+	std::uniform_real_distribution<float> speedDistribution{ 1.f, 2.f };
+	std::uniform_int_distribution<int> positionDistribution{ 0, 380 };
+
+	//set the size and x position to random numbers
+	const float size = sizeDistribution(generator);
+	const int x = positionDistribution(generator);
+
+	//create a new projectile
+	gm::Projectile* asteroid = new gm::Projectile{
+		{static_cast<float>(x), -49.f},
+		{size, size},
+		sf::Color::Cyan
+	};
 
-		//create random number distributions for size, speed and position
-		std::uniform_real_distribution<float> sizeDistribution{ 30.f, 50.f };
-		std::uniform_real_distribution<float> speedDistribution{ 1.f, 2.f };
-		std::uniform_int_distribution<int> positionDistribution{ 0, 380 };
-
-		//set the size and x position to random numbers
-		const float size = sizeDistribution(generator);
-		const int x = positionDistribution(generator);
-
-		//create a new projectile
-		gm::Projectile* asteroid = new gm::Projectile{
-			{static_cast<float>(x), -49.f},
-			{size, size},
-			sf::Color::Cyan
-		};
-
-		//add asteroid to projectiles list
-		std::size_t i = gm::addToVector(gameData.projectiles, asteroid);
-
-		//set asteroid attributes
-		gameData.projectiles[i]->group = "asteroid";
-		gameData.projectiles[i]->sprite.setTexture(gameData.asteroidsTexture);
-		gameData.projectiles[i]->sprite.setTextureRect(gameData.defaultTextureRect);
-		gameData.projectiles[i]->sprite.setScale({ (size + 6.f) / 16.f, (size + 6.f) / 16.f });
-		gameData.projectiles[i]->textureOffset = { 3.f, 3.f };
-		gameData.projectiles[i]->velocity = sf::Vector2f{ 0.f, 1.f } *conf::ENEMY_MOVEMENT_SPEED * speedDistribution(generator);
-		gameData.projectiles[i]->friction = { 1.f, 1.f };
-		gameData.projectiles[i]->hp = static_cast<int>(size);
-		gameData.projectiles[i]->maxHp = static_cast<int>(size);
-		gameData.projectiles[i]->collisionLayer = 1;
-
-		//assign a process function that is called every frame
-		asteroid->processCallback = &asteroidCallback;
-	}
+	//set asteroid attributes
+	asteroid->group = "asteroid";
+	asteroid->sprite.setTexture(gameData.asteroidsTexture);
+	asteroid->sprite.setTextureRect(gameData.defaultTextureRect);
+	asteroid->sprite.setScale({ (size + 6.f) / 16.f, (size + 6.f) / 16.f });
+	asteroid->textureOffset = { 3.f, 3.f };
+	asteroid->velocity = sf::Vector2f{ 0.f, 1.f } *conf::ENEMY_MOVEMENT_SPEED * speedDistribution(generator);
+	asteroid->friction = { 1.f, 1.f };
+	asteroid->hp = static_cast<int>(size);
+	asteroid->maxHp = static_cast<int>(size);
+	asteroid->collisionLayer = 1;
+
+	//assign a process function that is called every frame
+	asteroid->processCallback = &asteroidCallback;
+
+	return asteroid;
 }
 
 //called every frame to increase the size of the nebulas
@@ -308,91 +306,78 @@ static void nebulaCallback(gm::GameData& gameData, gm::Base* self)
 	}
 }
 
-//spawns a nebula
-static void spawnNebula(gm::GameData& gameData, int spawnRates = 10)
+//spawn pattern for nebulas
+static gm::Projectile* spawnNebula(gm::GameData& gameData, std::mt19937& generator)
 {
-	//spawn a nebula every 50 frames with a 1 / spawnRates of happening
-	if (gameData.frame % 50 == 0 && rand() % spawnRates == 1)
-	{
-		//used to generate random numbers
-		std::random_device rd;
-		std::mt19937 generator{ rd() };
+	//create random number distributions for speed and position
+	std::uniform_real_distribution<float> speedDistribution{ 1.f, 2.f };
+	std::uniform_int_distribution<int> positionDistribution{ 0, 420 };
+
+	//generate random position
+	const int x = positionDistribution(generator);
+
+	//create a new nebula
+	gm::Projectile* nebula = new gm::Projectile{
+		{static_cast<float>(x), -49.f},
+		{10.f, 10.f},
+		sf::Color::Cyan
+	};
+	
+	//make it a little transparent because it looks nicer
+	nebula->sprite.setColor(sf::Color{ 255, 255, 255, 100 });
+
+	//set nebula attributes
+	nebula->processCallback = &nebulaCallback;
+	nebula->group = "nebula";
+	nebula->sprite.setTexture(gameData.nebulaTexture);
+	nebula->sprite.setTextureRect(gameData.defaultTextureRect);
+	nebula->enableDamage = false;
+	nebula->takeDamage = false;
+	nebula->animation.clip = gameData.nebulaAnimationClip;
+	nebula->textureOffset = { 3.f, 3.f };
+	nebula->velocity = sf::Vector2f{ 0.f, 1.f } * conf::NEBULA_MOVEMENT_SPEED * speedDistribution(generator);
+	nebula->friction = { 1.f, 1.f };
+	nebula->hp = 10;
+	nebula->collisionLayer = 1;
+
+	return nebula;
+}
 
-		//create random number distributions for speed and position
-		std::uniform_real_distribution<float> speedDistribution{ 1.f, 2.f };
-		std::uniform_int_distribution<int> positionDistribution{ 0, 420 };
+//spawn pattern for health pick ups
+static gm::Projectile* spawnHealthPickup(gm::GameData& gameData, std::mt19937& generator)
+{
+	//only spawn health if the player is bellow 5 hp.
+	//This raises the difficulty. 
+	if (gameData.player.hp >= 5)
+		return nullptr;
 
-		//generate random position
-		const int x = positionDistribution(generator);
+	//create random number distributions for speed and position
+	std::uniform_real_distribution<float> speedDistribution{ 1.f, 2.f };
+	std::uniform_int_distribution<int> positionDistribution{ 0, 720 };
 
-		//create a new nebula
-		gm::Projectile* nebula = new gm::Projectile{
-			{static_cast<float>(x), -49.f},
-			{10.f, 10.f},
-			sf::Color::Cyan
-		};
-		
-		//make it a little transparent because it looks nicer
-		nebula->sprite.setColor(sf::Color{ 255, 255, 255, 100 });
-
-		//add projectiles list
-		std::size_t i = gm::addToVector(gameData.projectiles, nebula);
-
-		//set nebula attributes
-		gameData.projectiles[i]->processCallback = &nebulaCallback;
-		gameData.projectiles[i]->group = "nebula";
-		gameData.projectiles[i]->sprite.setTexture(gameData.nebulaTexture);
-		gameData.projectiles[i]->sprite.setTextureRect(gameData.defaultTextureRect);
-		gameData.projectiles[i]->enableDamage = false;
-		gameData.projectiles[i]->takeDamage = false;
-		gameData.projectiles[i]->animationLength = 48;
-		gameData.projectiles[i]->textureOffset = { 3.f, 3.f };
-		gameData.projectiles[i]->velocity = sf::Vector2f{ 0.f, 1.f } * conf::NEBULA_MOVEMENT_SPEED * speedDistribution(generator);
-		gameData.projectiles[i]->friction = { 1.f, 1.f };
-		gameData.projectiles[i]->hp = 10;
-		gameData.projectiles[i]->collisionLayer = 1;
-	}
-}
+	//generate random position
+	const int x = positionDistribution(generator);
 
-//creates a health pick up
-static void spawnHealthPickups(gm::GameData& gameData)
-{
-	//spawns a health pick up with a 1/10 chance every 10 frame
-	if (gameData.frame % 10 == 0 && rand() % 10 == 1)
-	{
-		//used to generate random numbers
-		std::random_device rd;
-		std::mt19937 generator{ rd() };
+	//create a new health pick up
+	gm::Projectile* healthPickUp = new gm::Projectile{
+		{static_cast<float>(x), -49.f},
+		{15.f, 15.f},
+		sf::Color::Cyan
+	};
 
-		//create random number distributions for speed and position
-		std::uniform_real_distribution<float> speedDistribution{ 1.f, 2.f };
-		std::uniform_int_distribution<int> positionDistribution{ 0, 720 };
-
-		//generate random position
-		const int x = positionDistribution(generator);
-
-		//create a new health pick up
-		gm::Projectile* healthPickUp = new gm::Projectile{
-			{static_cast<float>(x), -49.f},
-			{15.f, 15.f},
-			sf::Color::Cyan
-		};
-
-		//add the health pick up to the projectiles
-		std::size_t i = gm::addToVector(gameData.projectiles, healthPickUp);
-
-		//set nebula attributes
-		gameData.projectiles[i]->group = "healthPickUp";
-		gameData.projectiles[i]->sprite.setTexture(gameData.heartTexture);
-		gameData.projectiles[i]->sprite.setTextureRect(gameData.defaultTextureRect);
-		gameData.projectiles[i]->sprite.setColor(sf::Color::Red);
-		gameData.projectiles[i]->textureOffset = { -3.5f, -3.5f };
-		gameData.projectiles[i]->velocity = sf::Vector2f{ 0.f, 1.f } *conf::ENEMY_MOVEMENT_SPEED * speedDistribution(generator);
-		gameData.projectiles[i]->friction = { 1.f, 1.f };
-		gameData.projectiles[i]->collisionLayer = 2;
-		gameData.projectiles[i]->enableDamage = false;
-		gameData.projectiles[i]->animationLength = 1;
-	}
+	//set health pick up attributes
+	healthPickUp->group = "healthPickUp";
+	healthPickUp->sprite.setTexture(gameData.heartTexture);
+	healthPickUp->sprite.setTextureRect(gameData.defaultTextureRect);
+	healthPickUp->sprite.setColor(sf::Color::Red);
+	healthPickUp->textureOffset = { -3.5f, -3.5f };
+	healthPickUp->velocity = sf::Vector2f{ 0.f, 1.f } *conf::ENEMY_MOVEMENT_SPEED * speedDistribution(generator);
+	healthPickUp->friction = { 1.f, 1.f };
+	healthPickUp->collisionLayer = 2;
+	healthPickUp->enableDamage = false;
+	healthPickUp->animation.clip = gameData.stillAnimationClip;
+
+	return healthPickUp;
 }
 
 //creates a row of heart sprites. The size depends on the player health.
@@ -412,58 +397,83 @@ static void healthDisplay(sf::RenderWindow& window, const gm::GameData& gameData
 	}
 }
 
-//changes the difficulty of the game, based on the score.
-static void levels(gm::GameData& gameData)
+//spawn pattern for the homing swarm enemies
+static gm::Projectile* spawnSwarmAgent(gm::GameData& gameData, std::mt19937& generator)
 {
-	//get the score
-	const unsigned long long& score = gameData.score;
-
-	//asteroids spawn no matter what. The spawn chance will just increase after 200 score is reached.
-	if (score < 200)
-		spawnAsteroids(gameData);
+	//pick a random point just outside of one of the edges of the screen
+	std::uniform_int_distribution<int> edgeDistribution{ 0, 3 };
+	std::uniform_real_distribution<float> edgePositionDistribution{ 0.f, 1.f };
+
+	const int edge = edgeDistribution(generator);
+	const float edgePosition = edgePositionDistribution(generator);
+
+	sf::Vector2f position;
+	if (edge == 0)
+		position = { edgePosition * conf::WINDOW_WIDTH, -10.f };
+	else if (edge == 1)
+		position = { edgePosition * conf::WINDOW_WIDTH, conf::WINDOW_HEIGHT + 4.f };
+	else if (edge == 2)
+		position = { -10.f, edgePosition * conf::WINDOW_HEIGHT };
 	else
-	{
-		spawnAsteroids(gameData, 5);
-	}
+		position = { conf::WINDOW_WIDTH + 4.f, edgePosition * conf::WINDOW_HEIGHT };
 
-	//only spawn health if the player is bellow 5 hp.
-	//This raises the difficulty. 
-	if (gameData.player.hp < 5)
-		spawnHealthPickups(gameData);
+	//create the agent
+	gm::Projectile* agent = new gm::Projectile{
+		position,
+		{6.f, 6.f},
+		sf::Color::Yellow
+	};
 
-	//spawn rockets to the right of the player at score 50 and greater
-	if (score > 50)
-	{
-		spawnEnemyRocketShips(gameData, true);
-	}
+	//set the agent attributes. The sprite rotates around its center to face where it is going.
+	agent->group = gameData.swarm.agentGroup;
+	agent->sprite.setTexture(gameData.enemyRocketshipTexture);
+	agent->sprite.setTextureRect(gameData.defaultTextureRect);
+	agent->sprite.setColor(sf::Color{ 255, 160, 60 });
+	agent->sprite.setOrigin({ 8.f, 8.f });
+	agent->sprite.setScale({ 0.6f, 0.6f });
+	agent->textureOffset = { -3.f, -3.f };
+	agent->friction = { 1.f, 1.f };
+	agent->hp = 1;
+	agent->collisionLayer = 1;
+
+	return agent;
+}
 
-	//spawn nebula at score 100 and greater
-	if (score > 100)
-	{
-		spawnNebula(gameData);
-	}
+//registers the spawn patterns and loads the waves. The waves control the difficulty of the game, based on the score.
+static void initSpawnDirector(gm::GameData& gameData)
+{
+	gameData.spawnDirector.addPattern("asteroid", &spawnAsteroid);
+	gameData.spawnDirector.addPattern("health", &spawnHealthPickup);
+	gameData.spawnDirector.addPattern("rocketRight", &spawnEnemyRocketShipFromRight);
+	gameData.spawnDirector.addPattern("rocketLeft", &spawnEnemyRocketShipFromLeft);
+	gameData.spawnDirector.addPattern("nebula", &spawnNebula);
+	gameData.spawnDirector.addPattern("swarm", &spawnSwarmAgent);
 
-	//spawn rockets to the left at 150 and greater
-	if (score > 150)
-	{
-		spawnEnemyRocketShips(gameData, false);
-	}
+	gameData.swarm.settings.maxSpeed = conf::SWARM_MOVEMENT_SPEED;
 
-	//raise the chances of rockets spawning at 250 and greater. 
-	//follows a different pattern then asteroids due to technical difficulty and time constraints
-	if (score > 250)
+	if (!gameData.spawnDirector.loadFromFile("./assets/waves.txt"))
 	{
-		spawnEnemyRocketShips(gameData, true);
-		spawnEnemyRocketShips(gameData, false);
+		printf("Failed to load waves!\n");
 	}
 }
 
 
-int main()
+int main(int argc, char* argv[])
 {
+	//run the swarm benchmark without opening a window. Usage: SuperCoolGame --bench-swarm [agents] [steps]
+	if (argc > 1 && std::string{ argv[1] } == "--bench-swarm")
+	{
+		const std::size_t agentCount = (argc > 2) ? std::strtoul(argv[2], nullptr, 10) : 5000;
+		const unsigned int steps = (argc > 3) ? static_cast<unsigned int>(std::strtoul(argv[3], nullptr, 10)) : 600;
+		gm::runSwarmBenchmark(agentCount, steps);
+		return 0;
+	}
+
 	//create window
 	sf::RenderWindow window{ sf::VideoMode{ 1600, 800}, "Game"};
-	window.setFramerateLimit(60); // <-- the spawn rates are caculated based of off the fps, so changing this will affect the spawn rates.
+
+	//keeps the frame rate steady
+	gm::FramePacer framePacer{ conf::FRAME_RATE }; // <-- the spawn rates in assets/waves.txt are in frames, so changing this will affect the spawn rates.
 
 	//create camera
 	sf::View camera{ sf::FloatRect{
@@ -496,6 +506,7 @@ int main()
 
 	//init game
 	gm::GameData gameData;
+	initSpawnDirector(gameData);
 	initGame(gameData);
 
 	//used to tell when to switch from the main menu to the game
@@ -551,6 +562,7 @@ int main()
 			checkWindowInputs(window, gui);
 			gui.draw();
 			window.display();
+			framePacer.wait();
 		}
 
 		//add the score once the game starts
@@ -560,6 +572,14 @@ int main()
 		score->getRenderer()->setTextColor(sf::Color::White);
 		gui.add(score);
 
+		//shows the frame time statistics in debug mode
+		auto frameStatsText = tgui::Label::create();
+		frameStatsText->setPosition(5, 80);
+		frameStatsText->setTextSize(16);
+		frameStatsText->getRenderer()->setTextColor(sf::Color::White);
+		frameStatsText->setVisible(false);
+		gui.add(frameStatsText);
+
 		//start the game music
 		music.setLoopPoints({ sf::milliseconds(0), sf::milliseconds(27435) });
 		music.setLoop(true);
@@ -577,33 +597,44 @@ int main()
 			//check window inputs and player inputs
 			checkWindowInputs(window, gui);
 			playerMovement(gameData);
+
+			//remove the dead and far away game objects and sort the rest into active and visible lists
+			gm::cullObjects(gameData.cullingBounds, gameData.projectiles, gameData.activeProjectiles);
+			gm::cullObjects(gameData.cullingBounds, gameData.entities, gameData.activeEntities);
 			
-			//execute any process that are on the game objects
-			gm::executeProcesses(gameData, gameData.projectiles);
+			//execute any process that are on the visible game objects
+			gm::executeProcesses(gameData, gameData.activeProjectiles.visible);
+
+			//steer the swarm towards the center of the player. Off screen agents are steered too so they can come back.
+			gameData.swarm.step(gameData.player.position + gameData.player.size * 0.5f, gameData.activeProjectiles.active);
 
 			//calculate the movement for the entity and for the projectiles respectivly
-			gm::entityMovementCalculations(deltaTime, gameData.entities);
-			gm::projectileMovementCalculations(deltaTime, gameData.projectiles);
+			gm::entityMovementCalculations(deltaTime, gameData.activeEntities.active);
+			gm::projectileMovementCalculations(deltaTime, gameData.activeProjectiles.active);
 			
-			//perform the collision checks on the game objects (ie. Projectiles, Entities, StaticBodies)
-			gm::staticCollisionCheck(gameData.staticBodies, gameData.entities);
-			gm::entityCollisionCheck(gameData.entities);
-			gm::projectileCollisionCheck(gameData, gameData.projectiles, gameData.entities);
+			//perform the collision checks on the visible game objects (ie. Projectiles, Entities, StaticBodies)
+			gm::staticCollisionCheck(gameData.staticBodies, gameData.activeEntities.visible);
+			gm::entityCollisionCheck(gameData.activeEntities.visible);
+			gm::projectileCollisionCheck(gameData, gameData.activeProjectiles.visible, gameData.activeEntities.visible);
+
+			//advance the animations and put the sprites of the visible game objects in the sprite batch
+			gameData.spriteBatch.clear();
+			gm::animateSpriteList(gameData.animationClips, gameData.activeProjectiles.visible, gameData.spriteBatch);
+			gm::animateSpriteList(gameData.animationClips, gameData.activeEntities.visible, gameData.spriteBatch);
 
 			//clear the render texture
 			renderTexture.clear();
 
 			//if debug mode is enabled draw the collision shapes of the projectiles
 			if (gameData.debugMode)
-				gm::drawRectList(renderTexture, gameData.projectiles);
+				gm::drawRectList(renderTexture, gameData.activeProjectiles.visible);
 
 			//draw the sprites for the game objects
-			gm::drawSpriteList(gameData.frame, renderTexture, gameData.projectiles);
-			gm::drawSpriteList(gameData.frame, renderTexture, gameData.entities);
+			renderTexture.draw(gameData.spriteBatch);
 
 			//if debug mode is enabled draw the collision shapes of the entities
 			if (gameData.debugMode)
-				gm::drawRectList(renderTexture, gameData.entities);
+				gm::drawRectList(renderTexture, gameData.activeEntities.visible);
 
 
 			//display the render texture
@@ -623,12 +654,13 @@ int main()
 			gui.draw();
 
 			window.display();
+			framePacer.wait();
 
 			//shoot the player projectiles
 			shootPlayerProjectile(gameData);
 		
-			//scale the difficulty based of the score
-			levels(gameData);
+			//spawn the enemies and pick ups from the waves
+			gameData.spawnDirector.update(gameData);
 
 			//update the current frame
 			gameData.frame += 1;
@@ -637,6 +669,18 @@ int main()
 			gameData.score = static_cast<unsigned long long>(gameData.frame / 20);
 			score->setText("Score: " + std::to_string(gameData.score));
 
+			//update the frame time statistics a few times a second in debug mode
+			frameStatsText->setVisible(gameData.debugMode);
+			if (gameData.debugMode && gameData.frame % 10 == 0)
+			{
+				const gm::FrameStats& stats = framePacer.getStats();
+
+				char statsText[128];
+				snprintf(statsText, sizeof(statsText), "FPS: %.1f\nFrame: %.2f ms (%.2f - %.2f)\nJitter: %.3f ms",
+					stats.framesPerSecond, stats.averageFrameTime, stats.minFrameTime, stats.maxFrameTime, stats.jitter);
+				frameStatsText->setText(statsText);
+			}
+
 			//play the heal sound if the player gains health
 			if (gameData.player.hp > gameData.lastPlayerHp)
 			{
@@ -673,6 +717,7 @@ int main()
 		//stop the music and remove the game
 		music.stop();
 		gui.remove(score);
+		gui.remove(frameStatsText);
 
 		//create the game over menu
 		//create the title
@@ -749,6 +794,7 @@ int main()
 			checkWindowInputs(window, gui);
 			gui.draw();
 			window.display();
+			framePacer.wait();
 		}
 
 		//remove the game over menu
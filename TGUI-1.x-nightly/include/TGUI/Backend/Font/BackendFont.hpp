@@ -31,7 +31,12 @@
 #include <TGUI/Backend/Renderer/BackendTexture.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <unordered_map>
     #include <cstdint>
+    #include <string>
+    #include <memory>
+    #include <array>
+    #include <vector>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -225,6 +230,66 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD virtual Vector2u getTextureSize(unsigned int characterSize) = 0;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how far the signed distance field in the font texture extends around the glyphs
+        ///
+        /// @param characterSize  Size of the characters
+        ///
+        /// @return Spread of the distance field in pixels at the given character size, or 0 when the texture contains regular
+        ///         glyph bitmaps instead of distance fields
+        ///
+        /// When the font texture contains distance fields, the alpha value of a pixel is 0.5 on the edge of the glyph and
+        /// changes linearly to 0 and 1 at a distance of this spread outside and inside the glyph.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD virtual float getDistanceFieldSpread(unsigned int characterSize) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the horizontal offset to move to the next character after the given glyph
+        ///
+        /// @param codePoint      Unicode code point of the character
+        /// @param characterSize  Size of the character
+        /// @param bold           Is the glyph bold or regular?
+        ///
+        /// @return Advance of the glyph, identical to getGlyph(codePoint, characterSize, bold).advance
+        ///
+        /// The advance is only requested from the font the first time, later calls read it from a table that is kept per
+        /// character size. Characters in the Basic Multilingual Plane are stored in dense arrays, others in a hash map.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD float getGlyphAdvance(char32_t codePoint, unsigned int characterSize, bool bold);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the kerning offset of two glyphs, cached per character size
+        ///
+        /// @param first         Unicode code point of the first character
+        /// @param second        Unicode code point of the second character
+        /// @param characterSize Size of the characters
+        /// @param bold          Are the glyphs bold or regular?
+        ///
+        /// @return Kerning value for first and second, identical to getKerning(first, second, characterSize, bold)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD float getCachedKerning(char32_t first, char32_t second, unsigned int characterSize, bool bold);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the width of a single line of text
+        ///
+        /// @param text           The text to measure. Only the characters in front of the first newline are measured.
+        /// @param characterSize  Size of the characters
+        /// @param bold           Is the text bold or regular?
+        ///
+        /// @return Sum of the advances and kerning of the characters, with a tab counting as 4 spaces
+        ///
+        /// The widths of recently measured short lines are remembered, so that measuring the same line again is a lookup.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD float getLineWidth(const String& text, unsigned int characterSize, bool bold);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Forgets all cached advances, kerning values and line widths
+        ///
+        /// This is called automatically when the font is loaded or when its scale changes. Font implementations should call
+        /// it whenever something changes that affects the metrics of their glyphs.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clearMeasurementCache();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Enable or disable the smooth filter
         ///
@@ -279,11 +344,33 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD std::uint64_t constructGlyphKey(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness) const;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Advances, kerning values and line widths that were measured for a single character size and style.
+        // The advances of the BMP are stored in blocks of 256 code points that are only allocated when used,
+        // unknown entries in them are NaN.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct MeasurementTable
+        {
+            std::vector<std::unique_ptr<std::array<float, 256>>> advanceBlocks;
+            std::unordered_map<char32_t, float> advances;
+            std::unordered_map<std::uint64_t, float> kernings;
+            std::unordered_map<std::u32string, float> lineWidths;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the table for the given character size and style, creating it if it didn't exist yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD MeasurementTable& getMeasurementTable(unsigned int characterSize, bool bold);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         bool m_isSmooth = true;
         float m_fontScale = 1;
+
+        std::unordered_map<std::uint32_t, MeasurementTable> m_measurementTables; // Key = character size with bold flag in highest bit
+        MeasurementTable* m_lastMeasurementTable = nullptr;
+        std::uint32_t m_lastMeasurementKey = 0;
     };
 }
 
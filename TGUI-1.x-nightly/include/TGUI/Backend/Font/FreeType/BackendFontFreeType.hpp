@@ -32,6 +32,7 @@
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <unordered_map>
+    #include <vector>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -46,6 +47,21 @@
 
 TGUI_MODULE_EXPORT namespace tgui
 {
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Statistics about the glyph atlas pages of a font
+    ///
+    /// The hit rate of the glyph cache is glyphHits / (glyphHits + glyphMisses).
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct TGUI_API GlyphAtlasStatistics
+    {
+        std::size_t   pages = 0;          //!< Amount of atlas pages that currently exist (one per character size)
+        std::size_t   memoryUsage = 0;    //!< Bytes used by the pages, counting both the alpha values in memory and the RGBA textures
+        std::uint64_t glyphHits = 0;      //!< Amount of glyph lookups that found the glyph in the atlas
+        std::uint64_t glyphMisses = 0;    //!< Amount of glyph lookups that had to rasterize the glyph
+        std::uint64_t pageEvictions = 0;  //!< Amount of pages that were removed because the memory budget was exceeded
+        std::uint64_t pageResets = 0;     //!< Amount of times a page was full and had to be cleared to make room for new glyphs
+    };
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Font implementations that uses FreeType directly to load glyphs
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -188,6 +204,17 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD Vector2u getTextureSize(unsigned int characterSize) override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how far the signed distance field in the font texture extends around the glyphs
+        ///
+        /// @param characterSize  Size of the characters
+        ///
+        /// @return Spread of the distance field in pixels at the given character size, or 0 when distance field rendering is disabled
+        ///
+        /// @see setDistanceFieldRendering
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD float getDistanceFieldSpread(unsigned int characterSize) const override;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Enable or disable the smooth filter
         ///
@@ -208,6 +235,99 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void setFontScale(float scale) override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether glyphs are stored as signed distance fields instead of bitmaps
+        ///
+        /// @param distanceField  True to rasterize each glyph once and draw it at any character size, false to rasterize it per size
+        ///
+        /// In distance field mode, each glyph is rasterized only once at a fixed reference size. Texts of all character sizes
+        /// share the same atlas page and the renderer scales the glyphs with a shader that keeps their edges sharp.
+        /// Outlines are also drawn by the shader, so no separate outline glyphs are created. An outline can be at most
+        /// getDistanceFieldSpread(characterSize) pixels thick.
+        ///
+        /// Only renderers that have a shader for distance fields (currently the OpenGL3 renderer) draw such text sharply,
+        /// other renderers will show blurry text. The call is ignored when TGUI was built with a FreeType version older than 2.11.
+        /// Bitmap fonts keep rasterizing their glyphs per size. Distance field rendering is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setDistanceFieldRendering(bool distanceField);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether glyphs are stored as signed distance fields instead of bitmaps
+        ///
+        /// @return True if distance field rendering is enabled
+        ///
+        /// @see setDistanceFieldRendering
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool getDistanceFieldRendering() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the maximum amount of memory that the glyph atlas pages of this font may use
+        ///
+        /// @param bytes  Memory budget in bytes, counting both the alpha values in memory and the RGBA textures
+        ///
+        /// Every character size has its own atlas page. When the pages need more memory than the budget allows, the pages that
+        /// weren't used for the longest time are removed. A page that can't grow any further is cleared to make room for new glyphs.
+        /// The default budget is 64 MiB.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setAtlasMemoryBudget(std::size_t bytes);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the maximum amount of memory that the glyph atlas pages of this font may use
+        ///
+        /// @return Memory budget in bytes
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getAtlasMemoryBudget() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns statistics about the glyph atlas pages and how often glyphs were found in them
+        ///
+        /// @return Statistics since the font was loaded
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD GlyphAtlasStatistics getAtlasStatistics() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads glyphs into the atlas before they are needed
+        ///
+        /// @param characters      Characters to load
+        /// @param characterSizes  Character sizes at which the characters have to be loaded
+        /// @param bold            Load the bold version of the characters instead of the regular one?
+        ///
+        /// Glyphs are normally rasterized the first time that a text needs them, which makes the first frames that show new text
+        /// take longer. Loading the characters that will be used (e.g. ASCII and Latin-1 at the text sizes of the theme) up front
+        /// avoids this, especially when the result is stored with saveGlyphCache.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void prewarmGlyphs(const String& characters, const std::vector<unsigned int>& characterSizes, bool bold = false);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Writes the glyph atlas pages, including the metrics of their glyphs, to a file
+        ///
+        /// @param filename  Path to the file to write
+        ///
+        /// @return True on success, false if no font was loaded or the file couldn't be written
+        ///
+        /// @see loadGlyphCache
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool saveGlyphCache(const String& filename) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Replaces the glyph atlas pages with the ones that were stored in a file by saveGlyphCache
+        ///
+        /// @param filename  Path to the file to read
+        ///
+        /// @return True if the cache was loaded, false if the file couldn't be read or wasn't created for this font
+        ///
+        /// The cache is only used when it was created from the exact same font file, with the same FreeType version and the same
+        /// distance field setting. It has to be loaded after the font itself. A typical startup looks like this:
+        /// @code
+        /// if (!font->loadGlyphCache("glyphs.cache"))
+        /// {
+        ///     font->prewarmGlyphs(characters, {14, 18, 24});
+        ///     font->saveGlyphCache("glyphs.cache");
+        /// }
+        /// @endcode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool loadGlyphCache(const String& filename);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -220,20 +340,106 @@ TGUI_MODULE_EXPORT namespace tgui
             UIntRect  textureRect;   //!< Texture coordinates of the glyph inside the font's texture
         };
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Part of the skyline of an atlas page: the top of the used area between x and x+width lies at y
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct SkylineNode
+        {
+            unsigned int x;
+            unsigned int y;
+            unsigned int width;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Texture with the glyphs of a single character size
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct GlyphPage
+        {
+            std::unordered_map<std::uint64_t, Glyph> glyphs;
+            std::vector<SkylineNode> skyline;
+            std::unique_ptr<std::uint8_t[]> pixels; //!< Alpha value of each pixel in the texture, the color of the glyphs is always white
+            unsigned int textureSize = 0;
+            std::shared_ptr<BackendTexture> texture;
+            unsigned int textureVersion = 0;
+            std::vector<UIntRect> dirtyRects; //!< Parts of the pixels that changed since they were last copied to the texture
+            std::uint64_t lastUsed = 0; //!< Value of m_pageUseCounter when the page was last accessed
+        };
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Loads a glyph with freetype
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        TGUI_NODISCARD Glyph loadGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness);
+        TGUI_NODISCARD Glyph loadGlyph(GlyphPage& page, char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Returns a cached glyph or calls loadGlyph to load it when this is the first time the glyph is requested
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD Glyph getInternalGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the distance field glyph that is shared by all character sizes, with its metrics scaled to the character size
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Glyph getDistanceFieldGlyph(char32_t codePoint, unsigned int characterSize, bool bold);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the page for the character size, after creating it if it didn't exist yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD GlyphPage& getPage(unsigned int characterSize);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes all glyphs from the page and gives it the initial size again
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void resetPage(GlyphPage& page);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Reserves space in the texture to place the glyph
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        TGUI_NODISCARD UIntRect findAvailableGlyphRect(unsigned int width, unsigned int height);
+        TGUI_NODISCARD UIntRect findAvailableGlyphRect(GlyphPage& page, unsigned int width, unsigned int height);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the y position at which a rect would be placed when its left side is at the start of the skyline node,
+        // or returns false when the rect doesn't fit there
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static bool skylineFits(const GlyphPage& page, std::size_t nodeIndex, unsigned int width, unsigned int height, unsigned int& y);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Doubles the size of the page. Returns false if the page can't grow because of the texture size limit or memory budget.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool growPage(GlyphPage& page);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the size of the largest page that the texture size limit and memory budget allow
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD unsigned int getMaximumPageSize() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the least recently used pages, except for the given one, until the extra bytes fit in the memory budget
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void evictPages(const GlyphPage& pageToKeep, std::size_t extraBytes);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the amount of bytes used by all pages
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getPagesMemoryUsage() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Remembers that the pixels inside the rect changed and still need to be copied to the texture
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void addDirtyRect(GlyphPage& page, const UIntRect& rect);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Copies the pixels that changed since the last upload to the texture. Returns false if the texture couldn't be updated.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool uploadDirtyRects(GlyphPage& page);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether glyphs are currently stored as distance fields, which requires both the setting and a scalable font
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool usesDistanceField() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the hash of the font file, which is calculated the first time it is needed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::uint64_t getFontHash() const;
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Sets the character size on which the freetype operations are performed
@@ -248,15 +454,6 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
-        struct Row
-        {
-            Row(unsigned int rowTop, unsigned int rowHeight) : width(0), top(rowTop), height(rowHeight) {}
-
-            unsigned int width;  //!< Current width of the row
-            unsigned int top;    //!< Y position of the row into the texture
-            unsigned int height; //!< Height of the row
-        };
-
         FT_Library  m_library = nullptr;  // Handle to the freetype library
         FT_Face     m_face    = nullptr;  // Contains the font (typeface and style)
         FT_Stroker  m_stroker = nullptr;  // Used for rendering outlines
@@ -266,15 +463,18 @@ TGUI_MODULE_EXPORT namespace tgui
         std::unordered_map<unsigned int, float> m_cachedAscents;
         std::unordered_map<unsigned int, float> m_cachedDescents;
 
-        std::unordered_map<std::uint64_t, Glyph> m_glyphs;
-        unsigned int     m_nextRow = 3; //!< Y position of the next new row in the texture (first 2 rows contain pixels for underlining)
-        std::vector<Row> m_rows;
+        std::unordered_map<unsigned int, GlyphPage> m_pages; //!< Atlas pages, with the scaled character size as key
+        std::size_t m_atlasMemoryBudget = 64 * 1024 * 1024;
+        std::uint64_t m_pageUseCounter = 0;
+        GlyphAtlasStatistics m_atlasStatistics;
+        bool m_distanceField = false; //!< Are glyphs stored as signed distance fields at a single reference size?
 
         std::unique_ptr<std::uint8_t[]> m_fileContents;
-        std::unique_ptr<std::uint8_t[]> m_pixels;
-        std::shared_ptr<BackendTexture> m_texture;
-        unsigned int m_textureSize = 0;
-        unsigned int m_textureVersion = 0;
+        std::size_t m_fileSize = 0;
+        mutable std::uint64_t m_fontHash = 0; //!< Hash of the font file, to recognize glyph caches that were created for it
+        mutable bool m_fontHashCalculated = false; //!< The hash is only calculated when a glyph cache is saved or loaded
+        std::vector<std::uint8_t> m_uploadPixels; //!< RGBA pixels of a dirty rect, reused for every upload
+        unsigned int m_textureVersion = 0; //!< Incremented for every texture that is created, so that versions are never reused
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -32,6 +32,10 @@
 #include <TGUI/Outline.hpp>
 #include <TGUI/RenderStates.hpp>
 
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <unordered_map>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 TGUI_MODULE_EXPORT namespace tgui
@@ -39,6 +43,21 @@ TGUI_MODULE_EXPORT namespace tgui
     class Widget;
     class RootContainer;
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Statistics about how the draws of a frame were combined by a batching render target
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct TGUI_API BatchStatistics
+    {
+        std::size_t vertexArrays = 0;     //!< Amount of times drawVertexArray was called
+        std::size_t drawCalls = 0;        //!< Amount of draw calls that were actually issued
+        std::size_t vertices = 0;         //!< Total amount of vertices that were drawn
+        std::size_t indices = 0;          //!< Total amount of indices that were drawn
+        std::size_t quads = 0;            //!< Amount of quads that were drawn as instances instead of as vertices
+        std::size_t shapes = 0;           //!< Amount of circles and rounded rectangles that were drawn with a distance field shader
+        std::size_t textureFlushes = 0;   //!< Amount of batches that were ended because the texture changed
+        std::size_t clippingFlushes = 0;  //!< Amount of batches that were ended because the clipping changed
+    };
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Base class for render targets
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -257,6 +276,30 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void updateClipping(FloatRect clipRect, FloatRect clipViewport) = 0;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the points on a circle with radius 1 around the origin, starting at angle 0 and going counter-clockwise
+        ///
+        /// @param nrPoints  Amount of points on the circle
+        ///
+        /// @return Cached points of the circle, which remain valid until the next call to this function
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD const std::vector<Vector2f>& getUnitCirclePoints(unsigned int nrPoints);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws the vertices of a text or of its outline
+        ///
+        /// @param states             Render states to use for drawing, the transform already includes the position of the text
+        /// @param vertices           Triangles to draw, without indices
+        /// @param texture            Texture of the font
+        /// @param distanceFieldEdge  Alpha value in the texture at which the edge of the glyphs lies when the font texture contains
+        ///                           signed distance fields, or 0 when the texture contains regular glyph bitmaps
+        ///
+        /// The default implementation passes the vertices to drawVertexArray, which shows distance fields as blurry glyphs.
+        /// Render targets that can draw distance fields with a shader override this function.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void drawTextVertices(const RenderStates& states, const std::vector<Vertex>& vertices,
+                                      const std::shared_ptr<BackendTexture>& texture, float distanceFieldEdge);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -266,6 +309,15 @@ TGUI_MODULE_EXPORT namespace tgui
 
         std::vector<std::pair<FloatRect, FloatRect>> m_clipLayers;
         Vector2f m_pixelsPerPoint = {1, 1};
+
+        // Circles that were already tessellated, so that the sines and cosines don't have to be calculated on every draw
+        std::unordered_map<unsigned int, std::vector<Vector2f>> m_unitCirclePoints;
+
+        // Reused by drawCircle and drawRoundedRectangle so that they don't have to allocate memory on every draw
+        std::vector<Vector2f> m_outerShapePoints;
+        std::vector<Vector2f> m_innerShapePoints;
+        std::vector<Vertex> m_shapeVertices;
+        std::vector<unsigned int> m_shapeIndices;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
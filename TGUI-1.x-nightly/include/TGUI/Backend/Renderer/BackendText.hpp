@@ -173,10 +173,11 @@ TGUI_MODULE_EXPORT namespace tgui
         void updateVertices();
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Helper function used by updateVertices to add vertices for a glyph
+        // Helper function used by updateVertices to add vertices for a glyph. The quad is enlarged by the padding on each side,
+        // which is given both in pixels of the text and in pixels of the font texture.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void addGlyphQuad(std::vector<Vertex>& vertices, Vector2f position, const Vertex::Color& color,
-                          const FontGlyph& glyph, float fontScale, float italicShear);
+                          const FontGlyph& glyph, float padding, float texturePadding, float italicShear);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Helper function used by updateVertices to add vertices for a line
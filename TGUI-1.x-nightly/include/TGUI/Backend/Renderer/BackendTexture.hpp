@@ -27,6 +27,7 @@
 
 #include <TGUI/Font.hpp>
 #include <TGUI/String.hpp>
+#include <TGUI/Rect.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <memory>
@@ -79,6 +80,19 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual bool loadTextureOnly(Vector2u size, const std::uint8_t* pixels, bool smooth);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the pixels in part of the texture, without uploading the rest of the texture again
+        ///
+        /// @param rect   Part of the texture to change, which has to lie inside the texture
+        /// @param pixels Pointer to array of rect.width*rect.height*4 bytes with RGBA pixels
+        ///
+        /// @return True when the texture was updated, false when it wasn't (e.g. because the backend doesn't support this).
+        ///         When false is returned, the texture has to be loaded again with loadTextureOnly to change its pixels.
+        ///
+        /// @warning Just like loadTextureOnly, this only changes the texture and not the pixels that were stored by load
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool updatePixels(UIntRect rect, const std::uint8_t* pixels);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the size of the entire image
         /// @return Texture size
@@ -29,6 +29,7 @@
 
 #if !TGUI_BUILD_AS_CXX_MODULE
     #include <TGUI/Backend/Renderer/BackendRenderTarget.hpp>
+    #include <TGUI/Backend/Renderer/StreamBufferOpenGL.hpp>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -94,6 +95,13 @@ TGUI_MODULE_EXPORT namespace tgui
         void drawVertexArray(const RenderStates& states, const Vertex* vertices, std::size_t vertexCount,
                              const unsigned int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture) override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the size of the buffers that vertices and indices are streamed through and how often writing had to wait
+        ///
+        /// @return Statistics of the vertex and index buffers combined
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD StreamBufferStatistics getStreamBufferStatistics() const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -123,10 +131,8 @@ TGUI_MODULE_EXPORT namespace tgui
 
         unsigned int m_shaderProgram = 0;
         unsigned int m_vertexArray = 0;
-        unsigned int m_vertexBuffer = 0;
-        unsigned int m_indexBuffer = 0;
-        std::size_t m_vertexBufferSize = 0;
-        std::size_t m_indexBufferSize = 0;
+        StreamBufferOpenGL m_vertexBuffer;
+        StreamBufferOpenGL m_indexBuffer;
 
         std::unique_ptr<BackendTextureGLES2> m_emptyTexture;
         std::shared_ptr<BackendTextureGLES2> m_currentTexture;
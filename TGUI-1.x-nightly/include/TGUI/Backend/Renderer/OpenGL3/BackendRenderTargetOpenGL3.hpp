@@ -29,6 +29,7 @@
 
 #if !TGUI_BUILD_AS_CXX_MODULE
     #include <TGUI/Backend/Renderer/BackendRenderTarget.hpp>
+    #include <TGUI/Backend/Renderer/StreamBufferOpenGL.hpp>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -81,6 +82,46 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void drawGui(const std::shared_ptr<RootContainer>& root) override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws borders inside a provided rectangle
+        ///
+        /// @param states   Render states to use for drawing
+        /// @param borders  Widths of the borders
+        /// @param size     Size of the rectangle
+        /// @param color    Color of the borders
+        ///
+        /// The borders are drawn as 4 quads instead of 8 triangles, so that they can use the instanced quad renderer.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawBorders(const RenderStates& states, const Borders& borders, Vector2f size, Color color) override;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws a circle
+        ///
+        /// @param states           Render states to use for drawing
+        /// @param size             Diameter of the circle
+        /// @param backgroundColor  Color to fill the circle with
+        /// @param borderThickness  Thickness of the border to draw around the circle (outside given size if thickness is positive)
+        /// @param borderColor      Color of the border, if borderThickness differs from 0
+        ///
+        /// Unless the transform rotates or stretches the circle, it is drawn as a single quad with a signed distance field shader.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawCircle(const RenderStates& states, float size, const Color& backgroundColor, float borderThickness = 0, const Color& borderColor = {}) override;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws a rounded rectangle
+        ///
+        /// @param states           Render states to use for drawing
+        /// @param size             Size of the rectangle (includes borders)
+        /// @param backgroundColor  Fill color of the rectangle
+        /// @param radius           Radius of the rounded corners
+        /// @param borders          Optional borders on the sides of the rectangle (must be the same on all sides)
+        /// @param borderColor      Color of the borders
+        ///
+        /// Unless the transform rotates or stretches the rectangle, it is drawn as a single quad with a signed distance field shader.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawRoundedRectangle(const RenderStates& states, const Vector2f& size, const Color& backgroundColor, float radius,
+                                  const Borders& borders = {0}, const Color& borderColor = Color::Black) override;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Draws a vertex array. This is called by the other draw functions.
         ///
@@ -94,6 +135,20 @@ TGUI_MODULE_EXPORT namespace tgui
         void drawVertexArray(const RenderStates& states, const Vertex* vertices, std::size_t vertexCount,
                              const unsigned int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture) override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how the draws of the last drawGui call were combined into batches
+        ///
+        /// @return Statistics of the last frame
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD const BatchStatistics& getBatchStatistics() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the size of the buffers that vertices and indices are streamed through and how often writing had to wait
+        ///
+        /// @return Statistics of the vertex and index buffers combined
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD StreamBufferStatistics getStreamBufferStatistics() const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -107,26 +162,147 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateClipping(FloatRect clipRect, FloatRect clipViewport) override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws the vertices of a text or of its outline
+        ///
+        /// @param states             Render states to use for drawing, the transform already includes the position of the text
+        /// @param vertices           Triangles to draw, without indices
+        /// @param texture            Texture of the font
+        /// @param distanceFieldEdge  Alpha value in the texture at which the edge of the glyphs lies when the font texture contains
+        ///                           signed distance fields, or 0 when the texture contains regular glyph bitmaps
+        ///
+        /// Text with distance fields is drawn with a shader that keeps the edges of the glyphs sharp at any scale.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawTextVertices(const RenderStates& states, const std::vector<Vertex>& vertices,
+                              const std::shared_ptr<BackendTexture>& texture, float distanceFieldEdge) override;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Creates the vertex and index buffers
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void createBuffers();
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Points the vertex attributes of the VAO to the vertex buffer. Called again when the vertex buffer was recreated.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setVertexAttribs();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws the vertices or quads that were collected since the last flush with a single draw call
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void flushBatch();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the vertices to the batch, as quads when possible. The distance field edge is 0 unless the vertices belong to
+        // text of which the font texture contains signed distance fields.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addVertexArray(const RenderStates& states, const Vertex* vertices, std::size_t vertexCount, const unsigned int* indices,
+                            std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture, float distanceFieldEdge);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Changes the texture that is used by the batch, which requires a flush if the texture or distance field edge is different
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setBatchTexture(const std::shared_ptr<BackendTexture>& texture, float distanceFieldEdge = 0);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the triangles to the batch as quad instances. Every 2 triangles have to form an axis-aligned rectangle with
+        // texture coordinates that are also axis-aligned, and the transform can't rotate. Returns false if this isn't the case.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool addQuads(const Transform& transform, const Vertex* vertices, const unsigned int* indices, std::size_t count);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds a single untextured rectangle to the batch as a quad instance. The transform can't rotate.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addQuad(const Transform& transform, FloatRect rect, Vertex::Color color);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Points the instance attributes of the quad VAO to the instances starting at the given offset in the quad buffer
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setQuadAttribs(std::size_t offset);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds a rounded rectangle to the batch that is drawn by the signed distance field shader. The border lies inside the rect.
+        // Returns false when the transform rotates or doesn't scale uniformly, as the shape would no longer be a rounded rectangle.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool addShape(const Transform& transform, FloatRect rect, float radius, float borderThickness,
+                                     const Color& backgroundColor, const Color& borderColor);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Points the instance attributes of the shape VAO to the instances starting at the given offset in the shape buffer
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setShapeAttribs(std::size_t offset);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Flushes the last batch and stores the statistics of the frame. Called at the end of drawGui.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void finishDrawing();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         unsigned int m_shaderProgram = 0;
+        unsigned int m_quadShaderProgram = 0;
+        unsigned int m_shapeShaderProgram = 0;
+        unsigned int m_distanceFieldShaderProgram = 0;
+        unsigned int m_distanceFieldQuadShaderProgram = 0;
         unsigned int m_vertexArray = 0;
-        unsigned int m_vertexBuffer = 0;
-        unsigned int m_indexBuffer = 0;
-        std::size_t m_vertexBufferSize = 0;
-        std::size_t m_indexBufferSize = 0;
+        unsigned int m_quadVertexArray = 0;
+        unsigned int m_shapeVertexArray = 0;
+        StreamBufferOpenGL m_vertexBuffer;
+        StreamBufferOpenGL m_indexBuffer;
+        StreamBufferOpenGL m_quadBuffer;
+        StreamBufferOpenGL m_shapeBuffer;
+
+        // Which of the shader programs and VAOs is currently bound
+        enum class BoundProgram
+        {
+            Triangles,
+            Quads,
+            Shapes,
+            DistanceFieldTriangles,
+            DistanceFieldQuads
+        };
+        BoundProgram m_boundProgram = BoundProgram::Triangles;
 
         std::unique_ptr<BackendTextureOpenGL3> m_emptyTexture;
         std::shared_ptr<BackendTextureOpenGL3> m_currentTexture;
+        float m_batchDistanceFieldEdge = 0; // Edge of the distance field text in the batch, or 0 when the batch doesn't contain such text
+        unsigned int m_boundTexture = 0;
+
+        // Vertices are transformed on the CPU and collected here until the texture or clipping changes
+        std::vector<Vertex> m_batchVertices;
+        std::vector<unsigned int> m_batchIndices;
+
+        // Axis-aligned quads are collected separately, each one is expanded into 2 triangles by the vertex shader
+        struct QuadInstance
+        {
+            FloatRect rect;
+            FloatRect texRect;
+            Vertex::Color color;
+        };
+        std::vector<QuadInstance> m_batchQuads;
+
+        // Circles and rounded rectangles are drawn as a single quad, the shader calculates which pixels are inside the shape
+        struct ShapeInstance
+        {
+            FloatRect rect;
+            Vertex::Color backgroundColor;
+            Vertex::Color borderColor;
+            float radius;
+            float borderThickness;
+        };
+        std::vector<ShapeInstance> m_batchShapes;
+
+        BatchStatistics m_frameStatistics;
+        BatchStatistics m_lastFrameStatistics;
 
         Transform m_projectionTransform;
         int m_projectionMatrixShaderUniformLocation = 0;
+        int m_quadProjectionMatrixShaderUniformLocation = 0;
+        int m_shapeProjectionMatrixShaderUniformLocation = 0;
+        int m_distanceFieldProjectionMatrixShaderUniformLocation = 0;
+        int m_distanceFieldQuadProjectionMatrixShaderUniformLocation = 0;
+        int m_distanceFieldEdgeShaderUniformLocation = 0;
+        int m_distanceFieldQuadEdgeShaderUniformLocation = 0;
     };
 }
 
@@ -102,6 +102,13 @@ TGUI_MODULE_EXPORT namespace tgui
         void drawVertexArray(const RenderStates& states, const Vertex* vertices, std::size_t vertexCount,
                              const unsigned int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture) override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how the draws of the last drawGui call were combined into batches
+        ///
+        /// @return Statistics of the last frame
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD const BatchStatistics& getBatchStatistics() const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -120,12 +127,25 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD sf::RenderStates convertRenderStates(const RenderStates& states, const std::shared_ptr<BackendTexture>& texture);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws the vertices that were collected since the last flush with a single draw call
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void flushBatch();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         sf::RenderTarget* m_target = nullptr;
 
         Color m_clearColor;
+
+        // Triangles that are already transformed and expanded from their indices, waiting to be drawn with the same texture and view.
+        // They are stored as our own Vertex because it has the same memory layout as sf::Vertex but is cheaper to construct.
+        std::vector<Vertex> m_batchVertices;
+        std::shared_ptr<BackendTexture> m_batchTexture;
+
+        BatchStatistics m_frameStatistics;
+        BatchStatistics m_lastFrameStatistics;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
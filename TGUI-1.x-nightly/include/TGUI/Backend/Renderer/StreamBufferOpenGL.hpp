@@ -0,0 +1,176 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2024 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TGUI_STREAM_BUFFER_OPENGL_HPP
+#define TGUI_STREAM_BUFFER_OPENGL_HPP
+
+#include <TGUI/Config.hpp>
+
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <array>
+    #include <vector>
+    #include <cstddef>
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TGUI_MODULE_EXPORT namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Information about the buffers that an OpenGL render target streams its vertices and indices through
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct TGUI_API StreamBufferStatistics
+    {
+        std::size_t size = 0;           //!< Total size of the buffers in bytes
+        std::size_t stalls = 0;         //!< Amount of times the CPU had to wait for the GPU before it could reuse part of a buffer
+        std::size_t reallocations = 0;  //!< Amount of times a buffer had to be recreated because a draw didn't fit in it
+        bool persistentlyMapped = false; //!< Whether the buffers stay mapped (glBufferStorage), or are mapped for every write
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @internal
+    /// @brief Ring buffer that vertex or index data is streamed through
+    ///
+    /// The buffer is split into sections. Writes go to the next free part of the buffer. After the draw calls that read the
+    /// written data have been issued, fence() places a fence behind them for every section that was written to.
+    /// A section is only written again after the GPU has passed its fence, so data is never overwritten while the GPU may
+    /// still be reading it and the driver never has to reallocate the buffer.
+    ///
+    /// The buffer must be bound to its target while it is being mapped and unmapped.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API StreamBufferOpenGL
+    {
+    public:
+
+        /// @brief How data is written into the buffer
+        enum class Mode
+        {
+            Orphan,             //!< The data is copied with glBufferData on every unmap (OpenGL ES 2.0)
+            MapUnsynchronized,  //!< The written range is mapped with glMapBufferRange without synchronization
+            Persistent          //!< The buffer is created with glBufferStorage and stays mapped
+        };
+
+        StreamBufferOpenGL() = default;
+        StreamBufferOpenGL(const StreamBufferOpenGL&) = delete;
+        StreamBufferOpenGL& operator=(const StreamBufferOpenGL&) = delete;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Destructor that deletes the buffer and fences
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~StreamBufferOpenGL();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates the buffer and leaves it bound to its target
+        ///
+        /// @param target        GL_ARRAY_BUFFER or GL_ELEMENT_ARRAY_BUFFER
+        /// @param elementSize   Size of a single vertex or index in bytes
+        /// @param elementCount  Initial amount of elements that fit in the buffer
+        /// @param mode          How the buffer is written. Persistent falls back to MapUnsynchronized when mapping fails.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void create(unsigned int target, std::size_t elementSize, std::size_t elementCount, Mode mode);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Reserves room for elements and returns a pointer to write them to
+        ///
+        /// @param elementCount  Amount of elements that will be written
+        /// @param firstElement  Set to the index of the first reserved element inside the buffer
+        ///
+        /// @return Pointer to write the elements to, which is only valid until unmap is called
+        ///
+        /// The buffer may be recreated to make room for the elements, which can be checked with wasRecreated().
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD void* map(std::size_t elementCount, std::size_t& firstElement);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Finishes writing the elements that were reserved with the last map call
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void unmap();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Places a fence behind the draw calls that read the data that was written since the last call to this function
+        ///
+        /// This has to be called after issuing the draw calls that use the mapped data, before the buffer is mapped again.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void fence();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the buffer object was replaced since the last time this function was called
+        ///
+        /// When this returns true, vertex attributes that pointed to the old buffer have to be set again.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool wasRecreated();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the OpenGL buffer object
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD unsigned int getBuffer() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds the size and counters of this buffer to the statistics
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addStatistics(StreamBufferStatistics& statistics) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Allocates the storage for the current element count and maps it when using persistent mapping
+        void allocate();
+
+        // Deletes the buffer object and all fences
+        void destroy();
+
+        // Waits until the GPU is done with the section that is entered
+        void enterSection(std::size_t section);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        static constexpr std::size_t SectionCount = 4;
+
+        unsigned int m_target = 0;
+        unsigned int m_buffer = 0;
+        Mode m_mode = Mode::Orphan;
+        std::size_t m_elementSize = 0;
+        std::size_t m_elementCount = 0;
+
+        std::size_t m_writeOffset = 0;
+        std::size_t m_currentSection = 0;
+        std::array<void*, SectionCount> m_sectionFences = {};
+        std::array<bool, SectionCount> m_sectionsWritten = {}; // Sections that were written to since the last fence() call
+
+        void* m_persistentData = nullptr;
+        std::vector<unsigned char> m_orphanData;
+        std::size_t m_mappedBytes = 0;
+        bool m_recreated = false;
+
+        std::size_t m_stalls = 0;
+        std::size_t m_reallocations = 0;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_STREAM_BUFFER_OPENGL_HPP
@@ -29,6 +29,7 @@
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <list>
+    #include <unordered_map>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -160,6 +161,55 @@ TGUI_MODULE_EXPORT namespace tgui
             return std::dynamic_pointer_cast<WidgetType>(get(widgetName));
         }
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a pointer to a direct child of the container
+        ///
+        /// @param widgetName     The name that was given to the widget when it was added to the container
+        /// @param caseSensitive  Should the name match exactly, or should differences in case be ignored?
+        ///
+        /// Unlike get, this function doesn't search inside child containers. The lookup doesn't depend on the amount of
+        /// widgets in the container.
+        ///
+        /// @return Pointer to the child widget, or nullptr when no child has the given name
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Widget::Ptr getChild(const String& widgetName, bool caseSensitive = true) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a pointer to a widget by following a path of widget names
+        ///
+        /// @param path  Names of the widgets separated by dots, e.g. "SettingsPanel.AudioGroup.VolumeSlider"
+        ///
+        /// Each name in the path is looked up among the direct children of the container found by the previous name.
+        /// This is much faster than calling get on a large form, as it doesn't have to search the entire widget tree.
+        ///
+        /// @return Pointer to the widget, or nullptr when one of the widgets in the path doesn't exist
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Widget::Ptr getByPath(const String& path) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a pointer to a widget by following a path of widget names
+        ///
+        /// @param path  Names of the widgets separated by dots, e.g. "SettingsPanel.AudioGroup.VolumeSlider"
+        ///
+        /// @return Pointer to the widget, casted to the desired type, or nullptr when the widget doesn't exist or has a different type
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <class WidgetType>
+        TGUI_NODISCARD typename WidgetType::Ptr getByPath(const String& path) const
+        {
+            return std::dynamic_pointer_cast<WidgetType>(getByPath(path));
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns all widgets inside the container that match the given type and name prefix
+        ///
+        /// @param widgetType  Type of the widgets to find (e.g. "Button"), or an empty string to find widgets of any type
+        /// @param namePrefix  Text with which the names of the widgets have to start, or an empty string to accept any name
+        /// @param recursive   Should widgets inside child containers be returned as well?
+        ///
+        /// @return List of matching widgets, in the order in which they are drawn
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::vector<Widget::Ptr> findWidgets(const String& widgetType, const String& namePrefix = "", bool recursive = true) const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Removes a single widget that was added to the container
         ///
@@ -557,6 +607,11 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void rendererChanged(const String& property) override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Positions the children with an auto-layout once after widgets were added or removed during a batch update
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void batchUpdateFinished() override;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Draw the child widgets to a render target
         ///
@@ -622,6 +677,27 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void loadWidgetsImpl(const std::unique_ptr<DataIO::Node>& rootNode, bool replaceExisting);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds a child widget to the name index
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addToNameIndex(Widget* widget);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes a child widget from the name index. The name is passed because the widget may already have a new name.
+        // Returns false if the widget wasn't found in the index.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool removeFromNameIndex(Widget* widget, const String& name);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Called by a child widget when its name is changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void childNameChanged(Widget* widget, const String& oldName);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the widgets that match the type and name prefix to the list
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void findWidgetsImpl(std::vector<Widget::Ptr>& widgets, const String& widgetType, const String& namePrefix, bool recursive) const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -638,7 +714,12 @@ TGUI_MODULE_EXPORT namespace tgui
         // Does focusing the next widget always keep a widget from this container focused (e.g. in a ChildWindow)?
         bool m_isolatedFocus = false;
 
+        // Child widgets by their name in lowercase, so that widgets can be found without comparing the names of all children.
+        // Several children can have the same name, in which case the order in m_widgets decides which one is found.
+        std::unordered_map<std::u32string, std::vector<Widget*>> m_widgetNameIndex;
+
         friend class SubwidgetContainer; // Needs access to save and load functions
+        friend class Widget; // Needs to update the name index when a child widget is renamed
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
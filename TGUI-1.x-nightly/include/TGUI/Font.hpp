@@ -151,6 +151,17 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD FontGlyph getGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness = 0) const;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the horizontal offset to move to the next character after the given glyph
+        ///
+        /// @param codePoint      Unicode code point of the character
+        /// @param characterSize  Size of the character
+        /// @param bold           Is the glyph bold or regular?
+        ///
+        /// @return Advance of the glyph, the same as getGlyph(codePoint, characterSize, bold).advance but cached per size
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD float getGlyphAdvance(char32_t codePoint, unsigned int characterSize, bool bold = false) const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the kerning offset of two glyphs
         ///
@@ -161,6 +161,19 @@ TGUI_MODULE_EXPORT namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     TGUI_API bool writeFile(const String& filename, CharStringView textToWrite);
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Opens a file and writes the given bytes to it
+    ///
+    /// @param filename     Path to the file to write
+    /// @param data         Bytes to write to the file
+    /// @param sizeInBytes  Amount of bytes to write
+    ///
+    /// @return True on success, false if opening or writing to the file failed
+    ///
+    /// Unlike writeFile, the file is opened in binary mode so that line endings aren't converted on Windows.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    TGUI_API bool writeMemoryToFile(const String& filename, const std::uint8_t* data, std::size_t sizeInBytes);
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
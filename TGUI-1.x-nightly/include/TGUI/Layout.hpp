@@ -28,10 +28,12 @@
 #include <TGUI/Config.hpp>
 #include <TGUI/Vector2.hpp>
 #include <TGUI/AbsoluteOrRelativeValue.hpp>
+#include <TGUI/Exception.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <type_traits>
     #include <functional>
+    #include <cstdint>
     #include <memory>
     #include <string>
 #endif
@@ -93,6 +95,502 @@ TGUI_MODULE_EXPORT namespace tgui
         Fill        //!< Sets the position and size to fill the entire area that isn't already taken by components with the other AutoLayout values.
     };
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Layout expression that is parsed at compile time
+    ///
+    /// The expression uses the same syntax as the strings that are passed to a Layout, but it is parsed by a constexpr
+    /// constructor into a flat list of instructions in reverse polish notation. Constant parts of the expression are already
+    /// calculated while parsing, so e.g. "10 + 2 * 5" is stored as a single value.
+    ///
+    /// Constructing a Layout from an expression doesn't have to parse any strings:
+    /// @code
+    /// using namespace tgui::literals;
+    /// constexpr tgui::LayoutExpression titleBottom = "title.bottom + 10"_layout;
+    /// widget->setPosition("5%", titleBottom);
+    /// @endcode
+    ///
+    /// An invalid expression causes a compile error when it is evaluated at compile time, or a tgui::Exception otherwise.
+    ///
+    /// A minus sign that directly follows another operator negates the value behind it, so "a - -5" is the same as "a + 5".
+    /// This differs from a layout string, where "a - -5" results in the same value as "a - 5".
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class LayoutExpression
+    {
+    public:
+
+        static constexpr std::size_t MaxInstructions = 32; //!< Maximum amount of instructions that an expression can contain
+        static constexpr std::size_t MaxNameLength = 128;  //!< Maximum amount of characters in all widget names combined
+
+        /// Operation performed by a single instruction
+        enum class Opcode : std::uint8_t
+        {
+            Value,      //!< Pushes a constant
+            Binding,    //!< Pushes a property of a widget
+            Plus,       //!< Pops two values and pushes their sum
+            Minus,      //!< Pops two values and pushes their difference
+            Multiplies, //!< Pops two values and pushes their product
+            Divides,    //!< Pops two values and pushes their quotient
+            Minimum,    //!< Pops two values and pushes the smallest one
+            Maximum,    //!< Pops two values and pushes the largest one
+            Negate      //!< Pops a value and pushes it with the opposite sign
+        };
+
+        /// Property of a widget that a Binding instruction refers to
+        enum class Property : std::uint8_t
+        {
+            PosX,
+            PosY,
+            Left,
+            Top,
+            Width,
+            Height,
+            InnerWidth,
+            InnerHeight,
+            Size,      // Width or height, depending on which layout the expression is used in
+            InnerSize, // Inner width or inner height, depending on which layout the expression is used in
+            Position   // X or y position, depending on which layout the expression is used in
+        };
+
+        /// A single instruction of the expression
+        struct Instruction
+        {
+            Opcode opcode = Opcode::Value;
+            Property property = Property::PosX; // Only used by Binding
+            float value = 0;                    // Only used by Value
+            std::size_t nameOffset = 0;         // Only used by Binding, position of the widget name in the name buffer
+            std::size_t nameLength = 0;         // Only used by Binding, an empty name refers to the widget itself
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Parses a string literal
+        ///
+        /// @param expression  String to parse
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <std::size_t N>
+        constexpr explicit LayoutExpression(const char (&expression)[N]) :
+            LayoutExpression{expression, N - 1}
+        {
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Parses a string
+        ///
+        /// @param expression  String to parse
+        /// @param length      Amount of characters in the string
+        ///
+        /// The string doesn't have to outlive the expression.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        constexpr LayoutExpression(const char* expression, std::size_t length)
+        {
+            std::size_t pos = 0;
+            parseSum(expression, length, pos);
+
+            skipWhitespace(expression, length, pos);
+            if (pos != length)
+                throw Exception{U"Failed to parse layout expression. Unexpected character found."};
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of instructions in the expression
+        ///
+        /// @return Number of instructions
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD constexpr std::size_t getInstructionCount() const
+        {
+            return m_instructionCount;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns one of the instructions of the expression
+        ///
+        /// @param index  Index of the instruction, which has to be smaller than getInstructionCount()
+        ///
+        /// @return Instruction at the given index
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD constexpr const Instruction& getInstruction(std::size_t index) const
+        {
+            return m_instructions[index];
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the name of the widget that a Binding instruction refers to
+        ///
+        /// @param instruction  Binding instruction from this expression
+        ///
+        /// @return Name of the widget, or an empty string if the binding refers to the widget using the layout
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD String getBindingName(const Instruction& instruction) const
+        {
+            return String{std::string(m_names + instruction.nameOffset, instruction.nameLength)};
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the expression doesn't depend on any widget
+        ///
+        /// @return Was the entire expression calculated at compile time?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD constexpr bool isConstant() const
+        {
+            return (m_instructionCount == 1) && (m_instructions[0].opcode == Opcode::Value);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the value of a constant expression
+        ///
+        /// @return Value of the expression, or 0 if the expression isn't constant
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD constexpr float getConstantValue() const
+        {
+            return isConstant() ? m_instructions[0].value : 0;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Parses terms separated by + and -
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        constexpr void parseSum(const char* str, std::size_t length, std::size_t& pos)
+        {
+            parseProduct(str, length, pos);
+            while (true)
+            {
+                skipWhitespace(str, length, pos);
+                if ((pos < length) && ((str[pos] == '+') || (str[pos] == '-')))
+                {
+                    const Opcode opcode = (str[pos] == '+') ? Opcode::Plus : Opcode::Minus;
+                    ++pos;
+                    parseProduct(str, length, pos);
+                    addOperation(opcode);
+                }
+                else
+                    return;
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Parses factors separated by * and /
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        constexpr void parseProduct(const char* str, std::size_t length, std::size_t& pos)
+        {
+            parseFactor(str, length, pos);
+            while (true)
+            {
+                skipWhitespace(str, length, pos);
+                if ((pos < length) && ((str[pos] == '*') || (str[pos] == '/')))
+                {
+                    const Opcode opcode = (str[pos] == '*') ? Opcode::Multiplies : Opcode::Divides;
+                    ++pos;
+                    parseFactor(str, length, pos);
+                    addOperation(opcode);
+                }
+                else
+                    return;
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Parses a number, percentage, binding, min/max function, bracketed sub-expression or unary plus/minus
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        constexpr void parseFactor(const char* str, std::size_t length, std::size_t& pos)
+        {
+            skipWhitespace(str, length, pos);
+            if (pos >= length)
+                throw Exception{U"Failed to parse layout expression. Value expected."};
+
+            if ((str[pos] == '+') || (str[pos] == '-'))
+            {
+                const bool negate = (str[pos] == '-');
+                ++pos;
+                parseFactor(str, length, pos);
+                if (negate)
+                    addOperation(Opcode::Negate);
+            }
+            else if (str[pos] == '(')
+            {
+                ++pos;
+                parseSum(str, length, pos);
+                expectCharacter(str, length, pos, ')');
+            }
+            else if (((str[pos] >= '0') && (str[pos] <= '9')) || (str[pos] == '.'))
+                parseNumber(str, length, pos);
+            else
+            {
+                const std::size_t start = pos;
+                while ((pos < length) && !isSeparator(str[pos]))
+                    ++pos;
+
+                // Widget names can contain spaces, only the spaces at the end of the binding are ignored
+                std::size_t end = pos;
+                while ((end > start) && ((str[end - 1] == ' ') || (str[end - 1] == '\t')))
+                    --end;
+
+                if ((pos < length) && (str[pos] == '(') && (equals(str + start, end - start, "min") || equals(str + start, end - start, "max")))
+                {
+                    const Opcode opcode = (str[start + 1] == 'i') ? Opcode::Minimum : Opcode::Maximum;
+                    ++pos;
+                    parseSum(str, length, pos);
+                    expectCharacter(str, length, pos, ',');
+                    parseSum(str, length, pos);
+                    expectCharacter(str, length, pos, ')');
+                    addOperation(opcode);
+                }
+                else
+                    parseBinding(str + start, end - start);
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Parses a constant, which may be a percentage of the parent size
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        constexpr void parseNumber(const char* str, std::size_t length, std::size_t& pos)
+        {
+            float value = 0;
+            bool digitFound = false;
+            while ((pos < length) && (str[pos] >= '0') && (str[pos] <= '9'))
+            {
+                value = (value * 10) + static_cast<float>(str[pos] - '0');
+                digitFound = true;
+                ++pos;
+            }
+
+            if ((pos < length) && (str[pos] == '.'))
+            {
+                ++pos;
+                float scale = 0.1f;
+                while ((pos < length) && (str[pos] >= '0') && (str[pos] <= '9'))
+                {
+                    value += scale * static_cast<float>(str[pos] - '0');
+                    scale /= 10;
+                    digitFound = true;
+                    ++pos;
+                }
+            }
+
+            if (!digitFound)
+                throw Exception{U"Failed to parse layout expression. Invalid number found."};
+
+            skipWhitespace(str, length, pos);
+            if ((pos < length) && (str[pos] == '%'))
+            {
+                ++pos;
+
+                // Percentages are relative to the inner size of the parent, "100%" doesn't need the multiplication
+                if (value != 100)
+                {
+                    addValue(value / 100);
+                    addBinding("&", 1, Property::InnerSize);
+                    addOperation(Opcode::Multiplies);
+                }
+                else
+                    addBinding("&", 1, Property::InnerSize);
+            }
+            else
+                addValue(value);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Parses a binding such as "width", "&.innersize" or "button.right"
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        constexpr void parseBinding(const char* str, std::size_t length)
+        {
+            std::size_t nameLength = 0;
+            std::size_t propertyStart = 0;
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                if (str[i] == '.')
+                {
+                    nameLength = i;
+                    propertyStart = i + 1;
+                }
+            }
+
+            const char* property = str + propertyStart;
+            const std::size_t propertyLength = length - propertyStart;
+            if (equals(property, propertyLength, "x"))
+                addBinding(str, nameLength, Property::PosX);
+            else if (equals(property, propertyLength, "y"))
+                addBinding(str, nameLength, Property::PosY);
+            else if (equals(property, propertyLength, "left"))
+                addBinding(str, nameLength, Property::Left);
+            else if (equals(property, propertyLength, "top"))
+                addBinding(str, nameLength, Property::Top);
+            else if (equals(property, propertyLength, "w") || equals(property, propertyLength, "width"))
+                addBinding(str, nameLength, Property::Width);
+            else if (equals(property, propertyLength, "h") || equals(property, propertyLength, "height"))
+                addBinding(str, nameLength, Property::Height);
+            else if (equals(property, propertyLength, "iw") || equals(property, propertyLength, "innerwidth"))
+                addBinding(str, nameLength, Property::InnerWidth);
+            else if (equals(property, propertyLength, "ih") || equals(property, propertyLength, "innerheight"))
+                addBinding(str, nameLength, Property::InnerHeight);
+            else if (equals(property, propertyLength, "size"))
+                addBinding(str, nameLength, Property::Size);
+            else if (equals(property, propertyLength, "innersize"))
+                addBinding(str, nameLength, Property::InnerSize);
+            else if (equals(property, propertyLength, "pos") || equals(property, propertyLength, "position"))
+                addBinding(str, nameLength, Property::Position);
+            else if (equals(property, propertyLength, "right"))
+            {
+                addBinding(str, nameLength, Property::Left);
+                addBinding(str, nameLength, Property::Width);
+                addOperation(Opcode::Plus);
+            }
+            else if (equals(property, propertyLength, "bottom"))
+            {
+                addBinding(str, nameLength, Property::Top);
+                addBinding(str, nameLength, Property::Height);
+                addOperation(Opcode::Plus);
+            }
+            else
+                throw Exception{U"Failed to parse layout expression. Unknown value or widget property found."};
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds an instruction to the end of the list
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        constexpr Instruction& addInstruction(Opcode opcode)
+        {
+            if (m_instructionCount >= MaxInstructions)
+                throw Exception{U"Failed to parse layout expression. Expression is too long."};
+
+            Instruction& instruction = m_instructions[m_instructionCount++];
+            instruction.opcode = opcode;
+            return instruction;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds an instruction that pushes a constant
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        constexpr void addValue(float value)
+        {
+            addInstruction(Opcode::Value).value = value;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds an instruction that pushes a property of a widget and stores the name of the widget
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        constexpr void addBinding(const char* name, std::size_t nameLength, Property property)
+        {
+            if (m_namesLength + nameLength > MaxNameLength)
+                throw Exception{U"Failed to parse layout expression. Widget names are too long."};
+
+            Instruction& instruction = addInstruction(Opcode::Binding);
+            instruction.property = property;
+            instruction.nameOffset = m_namesLength;
+            instruction.nameLength = nameLength;
+
+            for (std::size_t i = 0; i < nameLength; ++i)
+                m_names[m_namesLength++] = name[i];
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds an operation on the values at the end of the list, or calculates the result if these values are constants
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        constexpr void addOperation(Opcode opcode)
+        {
+            // An operand that ends with a Value instruction can only consist of that single instruction
+            if (opcode == Opcode::Negate)
+            {
+                if ((m_instructionCount >= 1) && (m_instructions[m_instructionCount - 1].opcode == Opcode::Value))
+                {
+                    m_instructions[m_instructionCount - 1].value = -m_instructions[m_instructionCount - 1].value;
+                    return;
+                }
+            }
+            else if ((m_instructionCount >= 2)
+                  && (m_instructions[m_instructionCount - 2].opcode == Opcode::Value)
+                  && (m_instructions[m_instructionCount - 1].opcode == Opcode::Value))
+            {
+                const float left = m_instructions[m_instructionCount - 2].value;
+                const float right = m_instructions[m_instructionCount - 1].value;
+                float result = 0;
+                switch (opcode)
+                {
+                case Opcode::Plus:
+                    result = left + right;
+                    break;
+                case Opcode::Minus:
+                    result = left - right;
+                    break;
+                case Opcode::Multiplies:
+                    result = left * right;
+                    break;
+                case Opcode::Divides: // Same as in the Layout class, dividing by 0 results in 0
+                    result = (right != 0) ? (left / right) : 0;
+                    break;
+                case Opcode::Minimum:
+                    result = (right < left) ? right : left;
+                    break;
+                case Opcode::Maximum:
+                    result = (right > left) ? right : left;
+                    break;
+                default:
+                    break;
+                }
+
+                --m_instructionCount;
+                m_instructions[m_instructionCount - 1].value = result;
+                return;
+            }
+
+            addInstruction(opcode);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Skips the given character, which has to be the next non-whitespace character
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static constexpr void expectCharacter(const char* str, std::size_t length, std::size_t& pos, char expected)
+        {
+            skipWhitespace(str, length, pos);
+            if ((pos >= length) || (str[pos] != expected))
+                throw Exception{U"Failed to parse layout expression. Bracket mismatch or missing comma."};
+
+            ++pos;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Moves the position past spaces and tabs
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static constexpr void skipWhitespace(const char* str, std::size_t length, std::size_t& pos)
+        {
+            while ((pos < length) && ((str[pos] == ' ') || (str[pos] == '\t')))
+                ++pos;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether the character ends a binding
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static constexpr bool isSeparator(char c)
+        {
+            return (c == '+') || (c == '-') || (c == '*') || (c == '/') || (c == '(') || (c == ')') || (c == ',');
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Compares part of a string with a null-terminated string
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static constexpr bool equals(const char* str, std::size_t length, const char* other)
+        {
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                if (str[i] != other[i])
+                    return false;
+            }
+
+            return other[length] == '\0';
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        Instruction m_instructions[MaxInstructions] = {};
+        std::size_t m_instructionCount = 0;
+        char m_names[MaxNameLength] = {};
+        std::size_t m_namesLength = 0;
+    };
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Class to store the left, top, width or height of a widget
     ///
@@ -168,6 +666,16 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Layout(String expression);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructs the layout from an expression that was already parsed
+        ///
+        /// @param expression  Parsed expression
+        ///
+        /// This is faster than constructing the layout from a string, as no string has to be parsed at runtime. Bindings only
+        /// store the name of the widget, which is searched for when the layout is connected to a widget.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Layout(const LayoutExpression& expression);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// @brief Constructs a layout with a binding to a widget
@@ -274,6 +782,14 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD Layout* getRightOperand() const;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Returns the widget on which this layout depends (or nullptr if this layout does not bind a widget)
+        ///
+        /// Widgets that are bound by the operands are not returned, use getLeftOperand and getRightOperand to find those.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Widget* getBoundWidget() const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
@@ -298,6 +814,17 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void parseBindingString(const String& expression, Widget* widget, bool xAxis);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Find the widget corresponding to m_boundWidgetName and bind it if found, for bindings created from a LayoutExpression
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void bindWidgetByName(Widget* widget, bool xAxis);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the layout for the part of the expression that ends with the instruction at the given index.
+        // The index is moved to the instruction in front of that part of the expression.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static Layout createFromInstructions(const LayoutExpression& expression, std::size_t& index);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
@@ -308,6 +835,9 @@ TGUI_MODULE_EXPORT namespace tgui
         std::unique_ptr<Layout> m_rightOperand = nullptr; // The left operand of the operation in case the operation is a math operation
         Widget* m_boundWidget = nullptr; // The widget on which this layout depends in case the operation is a binding
         String m_boundString; // String referring to a widget on which this layout depends in case the layout was created from a string and contains a binding operation
+        String m_boundWidgetName; // Name of the bound widget in case the binding was created from a LayoutExpression, empty when binding the widget itself
+        bool m_boundByName = false; // Is the bound widget searched by m_boundWidgetName each time the layout is connected to a widget?
+        bool m_boundAxisDependent = false; // Does the binding refer to the size, inner size or position along the axis of the connected widget?
         std::function<void()> m_connectedWidgetCallback = nullptr; // Function to call when the value of the layout changes in case the layout and sublayouts are not all constants
         int m_callingCallbackCount = 0; // Used to detect that connectWidget is called in an infinity loop if certain layouts depend on each other
 
@@ -372,6 +902,19 @@ TGUI_MODULE_EXPORT namespace tgui
         {
         }
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructs the Layout2d from an expression that was already parsed
+        ///
+        /// @param expression  Parsed expression
+        ///
+        /// The expression will be used for both the x and y layouts.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Layout2d(const LayoutExpression& expression) :
+            x{expression},
+            y{expression}
+        {
+        }
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the cached value of the layout
         ///
@@ -515,6 +1058,20 @@ TGUI_MODULE_EXPORT namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    inline namespace literals
+    {
+        inline namespace layout_literals
+        {
+            /// @brief Parses a layout expression at compile time, e.g. "parent.width - 20"_layout
+            inline constexpr LayoutExpression operator""_layout(const char* str, std::size_t len)
+            {
+                return LayoutExpression{str, len};
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
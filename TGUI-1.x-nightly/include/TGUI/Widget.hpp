@@ -54,6 +54,7 @@
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <unordered_set>
+    #include <cstdint>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -915,6 +916,45 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void finishAllAnimations();
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Postpones the work that the widget does after every change until endBatchUpdate is called
+        ///
+        /// Containers, layouts and list widgets normally recalculate the positions of their children or items, their scrollbars
+        /// and their column widths after each added or removed widget or item. During a batch update this is only done once,
+        /// when the batch ends, which makes adding many widgets or items at once a lot faster.
+        ///
+        /// Calls can be nested, the postponed work is done by the endBatchUpdate call that matches the first beginBatchUpdate.
+        /// The widget should not be drawn during a batch update, as it may show an outdated layout.
+        ///
+        /// @see BatchUpdate
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void beginBatchUpdate();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Ends a batch update that was started with beginBatchUpdate
+        ///
+        /// When this ends the outermost batch update, the widget updates itself once for all changes that were made during it.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void endBatchUpdate();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether a batch update is in progress
+        ///
+        /// @return Was beginBatchUpdate called more often than endBatchUpdate?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isBatchUpdating() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many times a widget was updated because one of its layouts changed
+        ///
+        /// Layouts that depend on other widgets don't update the widget immediately. They mark it as outdated and all outdated
+        /// widgets are updated once, in the order in which they were marked, after the change has finished propagating.
+        /// This counter can be used to measure how much work e.g. resizing the window causes.
+        ///
+        /// @return Total amount of layout updates that were performed on all widgets
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::uint64_t getLayoutUpdateCount();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns whether the widget can currently gain focus
         /// @return Can the widget be focused right now?
@@ -1165,6 +1205,11 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void rendererChanged(const String& property);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Called when the outermost batch update ends, to do the work that was postponed during the batch
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void batchUpdateFinished();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Saves the widget as a tree node in order to save it to a file
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1195,6 +1240,21 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void recalculateBoundSizeLayouts();
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Marks the position or size layout of the widget as outdated and queues the widget to be updated
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void markLayoutDirty(bool sizeLayout);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates all widgets that were queued by markLayoutDirty
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void updateDirtyLayouts();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the widgets on which the layouts of this widget depend, followed by this widget itself if it was queued
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateDirtyLayout();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     public:
 
@@ -1305,6 +1365,18 @@ TGUI_MODULE_EXPORT namespace tgui
         bool m_autoLayoutUpdateEnabled = true;
         bool m_ignoreMouseEvents = false;
 
+        // Number of beginBatchUpdate calls without a matching endBatchUpdate call (this is not copied with the widget)
+        unsigned int m_batchUpdateDepth = 0;
+
+        // State of the deferred layout updates (this is not copied with the widget)
+        bool m_sizeLayoutDirty = false;
+        bool m_positionLayoutDirty = false;
+        bool m_layoutUpdateQueued = false;
+        bool m_layoutUpdateInProgress = false;
+        bool m_layoutCycleDetected = false;
+        unsigned int m_layoutUpdatesInPass = 0;
+        std::uint64_t m_layoutPassId = 0;
+
         // Cached renderer properties
         Font  m_fontCached = Font::getGlobalFont();
         float m_opacityCached = 1;
@@ -1316,6 +1388,44 @@ TGUI_MODULE_EXPORT namespace tgui
         friend class Container; // Container accesses save and load functions
     };
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Keeps a batch update going on a widget for as long as this object exists
+    ///
+    /// @code
+    /// {
+    ///     tgui::BatchUpdate batch{listView};
+    ///     for (const auto& row : rows)
+    ///         listView->addItem(row);
+    /// } // The column widths and scrollbar of the list view are only updated here
+    /// @endcode
+    ///
+    /// @see Widget::beginBatchUpdate
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API BatchUpdate
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Calls beginBatchUpdate on the widget
+        ///
+        /// @param widget  Widget to update in a batch
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        explicit BatchUpdate(Widget::Ptr widget);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Calls endBatchUpdate on the widget
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~BatchUpdate();
+
+        BatchUpdate(const BatchUpdate&) = delete;
+        BatchUpdate& operator=(const BatchUpdate&) = delete;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        Widget::Ptr m_widget;
+    };
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
@@ -153,6 +153,11 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void rendererChanged(const String& property) override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Repositions the widgets once after they were added, removed or reordered during a batch update
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void batchUpdateFinished() override;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // @brief Repositions and resize the widgets
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
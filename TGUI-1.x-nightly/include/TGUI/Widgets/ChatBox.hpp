@@ -30,7 +30,10 @@
 #include <TGUI/Text.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <atomic>
     #include <deque>
+    #include <mutex>
+    #include <vector>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -50,8 +53,12 @@ TGUI_MODULE_EXPORT namespace tgui
 
         struct Line
         {
-            Text text;
             String string;
+            Color color;
+            TextStyles style;
+            float height = 0; // Height of the line after word-wrapping
+            std::size_t id = 0;
+            bool wrapped = false; // False while the height is only estimated from the newlines in the string
         };
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -140,6 +147,58 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void addLine(const String& text, Color color, TextStyles style);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds multiple lines of text to the chat box at once
+        ///
+        /// This gives the same result as calling addLine for each line, but the scrollbar is only updated once and lines that
+        /// would immediately be removed again because of the line limit are skipped.
+        ///
+        /// The default text color and style will be used.
+        ///
+        /// @param lines  Lines of text that will be added to the chat box
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addLines(const std::vector<String>& lines);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds multiple lines of text to the chat box at once
+        ///
+        /// This gives the same result as calling addLine for each line, but the scrollbar is only updated once and lines that
+        /// would immediately be removed again because of the line limit are skipped.
+        ///
+        /// The default text style will be used.
+        ///
+        /// @param lines  Lines of text that will be added to the chat box
+        /// @param color  Color of the text
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addLines(const std::vector<String>& lines, Color color);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds multiple lines of text to the chat box at once
+        ///
+        /// This gives the same result as calling addLine for each line, but the scrollbar is only updated once and lines that
+        /// would immediately be removed again because of the line limit are skipped.
+        ///
+        /// @param lines  Lines of text that will be added to the chat box
+        /// @param color  Color of the text
+        /// @param style  Text style
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addLines(const std::vector<String>& lines, Color color, TextStyles style);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Queues a line of text to be added to the chat box on the next frame
+        ///
+        /// Unlike the other functions of the chat box, this function may be called from any thread, e.g. to show log messages.
+        /// The queued lines are added together in the gui thread once per frame, while the chat box is visible.
+        ///
+        /// While the chat box is hidden, the lines remain in the queue. When a line limit is set, only the newest lines that fit
+        /// within the limit are kept in the queue. Without a line limit, the queue keeps growing until the chat box is shown again.
+        ///
+        /// @param text   Text that will be added to the chat box
+        /// @param color  Color of the text, or an unset color to use the text color of the chat box
+        /// @param style  Text style, or unset text styles to use the text style of the chat box
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void queueLine(String text, Color color = {}, TextStyles style = {});
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the contents of the requested line
         ///
@@ -335,12 +394,28 @@ TGUI_MODULE_EXPORT namespace tgui
     private:
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Recalculates the text attribute of the line
+        // Recalculates the height that the line occupies after word-wrapping
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void recalculateLineText(Line& line);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Recalculates all text attributes, recalculate the full text height and update the displayed text
+        // Gives the line an estimated height based on the newlines in its string, without word-wrapping it
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void estimateLineHeight(Line& line);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the height of a text that consists of the given amount of lines
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD float getTextHeight(std::size_t nrLines) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the string of the line with newlines inserted where it has to be word-wrapped
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD String getWrappedLineString(const Line& line) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Resets the heights of all lines to their estimate, recalculate the full text height and update the displayed text.
+        // The lines are word-wrapped again once they come near the visible area.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void recalculateAllLines();
 
@@ -349,6 +424,17 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void recalculateFullTextHeight();
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the scrollbar after m_fullTextHeight changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateScrollbarMaximum();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds a line and removes the oldest line when the line limit is reached, without updating the scrollbar.
+        // The line only gets an estimated height, it is word-wrapped once it comes near the visible area.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void insertLine(const String& text, Color color, TextStyles style);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Updates the position of the lines
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -359,6 +445,22 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateRendering();
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Finds the lines that overlap with the given vertical range. The range of lines is [firstLine, lastLine).
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void findLinesInRange(float rangeTop, float rangeBottom, std::size_t& firstLine, float& firstLineTop, std::size_t& lastLine) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Word-wraps the lines near the visible area that only have an estimated height. Returns whether any height changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool wrapLinesNearView();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes sure that m_visibleLines contains a text for every line near the visible area.
+        // Texts of lines that are still near the visible area are kept, the others are reused for the lines that became visible.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVisibleLines() const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -392,6 +494,11 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateTextSize() override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // This function is called every frame with the time passed since the last frame.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool updateTime(Duration elapsedTime) override;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Returns the size without the borders
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -416,6 +523,43 @@ TGUI_MODULE_EXPORT namespace tgui
         bool m_newLinesBelowOthers = true;
 
         std::deque<Line> m_lines;
+        std::size_t m_nextLineId = 1;
+
+        // Lines added with queueLine, which are moved to m_lines in updateTime.
+        // The mutex can't be copied, so a copied chat box starts with an empty queue.
+        // The line limit is copied into an atomic so that queueLine can read it from other threads.
+        struct QueuedLine
+        {
+            String text;
+            Color color;
+            TextStyles style;
+        };
+        struct LineQueue
+        {
+            LineQueue() = default;
+            LineQueue(const LineQueue& other) : maxLines{other.maxLines.load()} {}
+            LineQueue& operator=(const LineQueue& other) { maxLines = other.maxLines.load(); return *this; }
+
+            std::mutex mutex;
+            std::deque<QueuedLine> lines;
+            std::atomic<std::size_t> maxLines{0};
+        };
+        LineQueue m_lineQueue;
+        std::deque<QueuedLine> m_dequeuedLines; // Swapped with the queue to reuse its memory
+
+        // Only the lines that are visible (or close to the visible area) have a Text object, which are recycled when scrolling.
+        // The pool is rebuilt from draw when the visible area leaves the range of lines for which it was created.
+        struct VisibleLine
+        {
+            std::size_t lineId = 0; // 0 when the text is no longer valid for any line
+            Text text;
+        };
+        mutable std::vector<VisibleLine> m_visibleLines;
+        mutable std::size_t m_firstVisibleLine = 0;
+        mutable float m_firstVisibleLineTop = 0;
+        mutable float m_visibleRangeTop = 0;
+        mutable float m_visibleRangeBottom = 0;
+        mutable bool m_visibleLinesOutdated = true;
 
         Sprite m_spriteBackground;
 
@@ -320,6 +320,11 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateWidgets();
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the widgets once after they were added, removed or resized during a batch update
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void batchUpdateFinished() override;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Updates the grid to the correct size when auto-sizing. This function should only be called if m_autoSize is true.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -584,6 +584,11 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void scrollbarValueChanged() override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the item positions and emits the postponed onScroll signal once items were added or removed in a batch
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void batchUpdateFinished() override;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Returns the size without the borders
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -57,6 +57,29 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         using ColumnAlignment TGUI_DEPRECATED("Use tgui::HorizontalAlignment instead") = HorizontalAlignment;
 
+        /// Function that returns the text of a cell in virtual mode, given the row and column index
+        using ItemProvider = std::function<String(std::size_t row, std::size_t column)>;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief How the cells of a column are compared when sorting
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        enum class SortType
+        {
+            Text,                //!< Compare the characters of the cells
+            TextCaseInsensitive, //!< Compare the characters of the cells after converting them to lowercase
+            Numeric              //!< Compare the cells as numbers. Cells that aren't numbers are placed below the others.
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Column to sort on and the order in which its cells are sorted
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct SortColumn
+        {
+            std::size_t index = 0;
+            SortType type = SortType::Text;
+            bool descending = false;
+        };
+
         struct Item
         {
             std::vector<Text> texts;
@@ -561,6 +584,64 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void sort(std::size_t index, const std::function<bool(const String&, const String&)>& cmp);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sorts the items on one or more columns
+        ///
+        /// @param columns  Columns to sort on. A column only decides the order of items that are equal in all columns before it.
+        ///
+        /// The sort is stable, items that are equal in all given columns keep their order. The cells are only read once to
+        /// create the keys that are compared, and large lists are sorted on multiple threads. Selected items stay selected.
+        ///
+        /// Example:
+        /// @code
+        /// listView->sort({{2, tgui::ListView::SortType::Numeric, true}, {0, tgui::ListView::SortType::TextCaseInsensitive}});
+        /// @endcode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void sort(const std::vector<SortColumn>& columns);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Switches the list view to virtual mode, where the texts of the items are requested when they are needed
+        ///
+        /// @param itemCount      Amount of rows in the list view
+        /// @param provider       Function that returns the text of a cell for a given row and column index
+        /// @param itemWidthHint  Width that auto-resizing columns reserve for the items, as they can't be measured in virtual mode
+        ///
+        /// In virtual mode the list view doesn't store the items. Only the rows that are visible get a Text object, which are
+        /// reused when scrolling, so the list view can hold millions of rows. Selection, scrolling and sorting work on row
+        /// indices like usual. Items can't be added, changed or removed individually and have no data or icons in this mode.
+        ///
+        /// All existing items are removed when calling this function. Call removeAllItems() to leave the virtual mode.
+        ///
+        /// Example:
+        /// @code
+        /// listView->setVirtualItems(lines.size(), [&lines](std::size_t row, std::size_t) { return lines[row]; });
+        /// @endcode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setVirtualItems(std::size_t itemCount, ItemProvider provider, float itemWidthHint = 0);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the amount of rows while in virtual mode, e.g. when rows were appended to the data
+        ///
+        /// @param itemCount  New amount of rows in the list view
+        ///
+        /// Rows that were added after the list view was sorted are placed below the sorted rows.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setVirtualItemCount(std::size_t itemCount);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Requests the texts of the visible rows again in virtual mode, to be called when the data of rows changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void refreshVirtualItems();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the list view is in virtual mode
+        ///
+        /// @return Are the items requested from a provider function?
+        ///
+        /// @see setVirtualItems
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isVirtual() const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the height of the items in the list view
         ///
@@ -1065,11 +1146,47 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateVerticalScrollbarMaximum();
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Scrolls to the bottom after items were added if auto-scrolling is enabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void autoScrollToBottom();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the column widths and scrollbars once after items were added or removed in a batch
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void batchUpdateFinished() override;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Draw the header text for a single column
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void drawHeaderText(BackendRenderTarget& target, RenderStates states, float columnWidth, float headerHeight, std::size_t column) const;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Reorders the items after sorting. The item at index order[i] is moved to index i, the selection moves along.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void applySortOrder(const std::vector<std::size_t>& order);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the text color that an item should have based on whether it is selected or hovered
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD const Color& getItemTextColor(std::size_t index) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes certain that m_virtualItems contains the items from firstItem to lastItem in virtual mode.
+        // Items of rows that are no longer visible are moved to the pool, new rows take their Text objects from the pool.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVirtualItems(std::size_t firstItem, std::size_t lastItem) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Fills an item from the pool with the texts of a row in virtual mode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void fillVirtualItem(Item& item, std::size_t index) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the item that is drawn for a visible row, which is only stored for the visible rows in virtual mode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD const Item& getDrawnItem(std::size_t index) const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Draw the texts in a single column
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1106,6 +1223,16 @@ TGUI_MODULE_EXPORT namespace tgui
         std::vector<Item>   m_items;
         std::set<std::size_t> m_selectedItems;
 
+        // Virtual mode, which is active when a provider is set. Only the items of the visible rows exist, in m_virtualItems.
+        ItemProvider m_virtualItemProvider;
+        std::size_t m_virtualItemCount = 0;
+        float m_virtualItemWidthHint = 0;
+        std::vector<std::size_t> m_virtualItemOrder; // Row of the provider for each displayed row after sorting, empty when unsorted
+        mutable std::vector<Item> m_virtualItems;
+        mutable std::vector<Item> m_virtualItemPool;
+        mutable std::size_t m_virtualFirstItem = 0;
+        mutable bool m_virtualItemsValid = false;
+
         int m_hoveredItem = -1;
         int m_firstSelectedItemIndex = -1;
         int m_focusedItemIndex = -1;
@@ -1134,6 +1261,7 @@ TGUI_MODULE_EXPORT namespace tgui
         int m_mouseOnHeaderIndex = -1; // If the left mouse is down, this contains the index of the column if the mouse went down on the header
         int m_possibleDoubleClick = false; // Will be set to true after the first click, but gets reset to false when the second click does not occur soon after
         bool m_autoScroll = true; // Should the list view scroll to the bottom when a new item is added?
+        bool m_autoScrollPending = false; // Were items added during a batch update while auto-scrolling is enabled?
 
         Sprite m_spriteHeaderBackground;
         Sprite m_spriteBackground;
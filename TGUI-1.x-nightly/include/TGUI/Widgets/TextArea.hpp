@@ -476,13 +476,37 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void rearrangeText(bool keepSelection, const bool emitCaretChangedPosition = true);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Rearranges only the paragraphs that contain the lines from firstLine to lastLine, after the text in those paragraphs
+        // was changed. All other lines have to still match the text. Falls back to rearrangeText when the lines are outdated.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void rearrangeChangedLines(std::size_t firstLine, std::size_t lastLine, bool keepSelection, bool emitCaretChangedPosition = true);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the width at which lines are word-wrapped, or 0 when the horizontal scrollbar is used instead of word-wrap.
+        // A negative value is returned when there is no room for the text.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD float getWordWrapWidth() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Splits the text into word-wrapped lines and adds them to the given lists, together with the amount of lines in each
+        // paragraph and the width of each line
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void splitTextIntoLines(const String& text, float wordWrapWidth, std::vector<String>& lines,
+                                std::vector<std::size_t>& paragraphLineCounts, std::vector<float>& lineWidths) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Restores the selection and updates the scrollbars after the lines have been rearranged
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void finishRearrangeText(std::size_t selStart, std::size_t selEnd, bool keepSelection, bool emitCaretChangedPosition);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Updates the physical size of the scrollbars, as well as the viewport size.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateScrollbars();
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // This function will split the text into five pieces so that the text can be easily drawn.
+        // Updates the caret and scrollbars after the selection changed and rebuilds the texts that are drawn.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateSelectionTexts();
 
@@ -585,6 +609,12 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void recalculateVisibleLines();
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Splits the lines around the visible area into five pieces so that the text can be easily drawn.
+        // Lines that are more than a screen away from the visible lines are not part of the texts.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateTextWindow();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Retrieves a signal based on its name
         ///
@@ -626,6 +656,14 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void scrollbarPolicyChanged(Orientation orientation) override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Called when the value of one of the scrollbars has been changed calling either
+        ///        getVerticalScrollbar()->setValue(...) or getHorizontalScrollbar()->setValue(...)
+        ///
+        /// @param orientation  Vertical or Horizontal depending on which scrollbar triggered the callback
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void scrollbarValueChanged(Orientation orientation) override;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -655,6 +693,13 @@ TGUI_MODULE_EXPORT namespace tgui
 
         std::vector<String> m_lines;
 
+        // Width of each line in m_lines, only calculated when the horizontal scrollbar can be shown
+        std::vector<float> m_lineWidths;
+
+        // Amount of lines in m_lines for each paragraph (part of the text between newline characters).
+        // The list is empty when m_lines no longer matches the text and has to be fully rebuilt.
+        std::vector<std::size_t> m_paragraphLineCounts;
+
         // The maximum characters (0 by default, which means no limit)
         std::size_t m_maxChars = 0;
 
@@ -681,6 +726,11 @@ TGUI_MODULE_EXPORT namespace tgui
         Text m_textAfterSelection2;
         Text m_defaultText;
 
+        // The texts above only contain the lines in [m_textWindowFirstLine, m_textWindowLastLine)
+        std::size_t m_textWindowFirstLine = 0;
+        std::size_t m_textWindowLastLine = 0;
+        bool m_textWindowOutdated = true;
+
         std::vector<FloatRect> m_selectionRects;
 
         // Is there a possibility that the user is going to double click?
@@ -29,6 +29,10 @@
 #include <TGUI/Renderers/TreeViewRenderer.hpp>
 #include <TGUI/Text.hpp>
 
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <unordered_map>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 TGUI_MODULE_EXPORT namespace tgui
@@ -45,9 +49,13 @@ TGUI_MODULE_EXPORT namespace tgui
 
         static constexpr const char StaticWidgetType[] = "TreeView"; //!< Type name of the widget
 
+        /// @brief Function that adds the children of a node with addChildItem when the node is expanded for the first time
+        using ChildrenLoader = std::function<void(std::size_t nodeId)>;
+
         /// @brief Read-only node representation used by getNode and getNodes
         struct ConstNode
         {
+            std::size_t id = 0;
             bool expanded = true;
             String text;
             std::vector<ConstNode> nodes;
@@ -57,8 +65,10 @@ TGUI_MODULE_EXPORT namespace tgui
         struct Node
         {
             Text text;
+            std::size_t id = 0;
             unsigned int depth = 0;
             bool expanded = true;
+            bool childrenPending = false; // Children will be added by the children loader when the node is first expanded
             Node* parent = nullptr;
             std::vector<std::shared_ptr<Node>> nodes;
         };
@@ -216,6 +226,115 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void removeAllItems();
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a new item below the item with the given id
+        ///
+        /// @param parentId         Id of the parent item, or 0 to add a root item
+        /// @param text             Text of the new item
+        /// @param childrenPending  Should the item be shown as a collapsed branch of which the children are only added by
+        ///                         the children loader once the item gets expanded?
+        ///
+        /// @return Id of the new item, or 0 when no item with the parent id exists
+        ///
+        /// Unlike addItem, this function doesn't search the hierarchy by text and doesn't rebuild the list of visible items,
+        /// which makes it suitable for trees with a very large amount of items.
+        ///
+        /// Example code:
+        /// @code
+        /// treeView->setChildrenLoader([&](std::size_t nodeId) {
+        ///     for (const auto& entry : listDirectory(paths[nodeId]))
+        ///         paths[treeView->addChildItem(nodeId, entry.name, entry.isDirectory)] = entry.path;
+        /// });
+        /// paths[treeView->addChildItem(0, "/", true)] = "/";
+        /// @endcode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t addChildItem(std::size_t parentId, const String& text, bool childrenPending = false);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets the function that adds the children of an item that was added with childrenPending set to true
+        ///
+        /// @param loader  Function that gets called with the id of the item right before the item is expanded for the first time
+        ///
+        /// The loader is expected to call addChildItem for each child of the item. Each item is only loaded once,
+        /// call setItemChildrenPending to have the loader called again the next time the item is expanded.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setChildrenLoader(ChildrenLoader loader);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the children of an item still have to be added by the children loader
+        ///
+        /// @param id               Id of the item
+        /// @param childrenPending  Should the children loader be called when the item is expanded?
+        ///
+        /// @return True when the item exists, false otherwise
+        ///
+        /// Marking an item as pending collapses it and removes its current children, so that they get loaded again when
+        /// the item is expanded.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool setItemChildrenPending(std::size_t id, bool childrenPending);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the id of an item
+        ///
+        /// @param hierarchy  Hierarchy of items, identifying the node
+        ///
+        /// @return Id of the item, or 0 when the hierarchy didn't match any item
+        ///
+        /// Ids are unique within the tree view and don't change when the item is renamed or moved.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getItemId(const std::vector<String>& hierarchy) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the hierarchy of the item with the given id
+        ///
+        /// @param id  Id of the item
+        ///
+        /// @return Hierarchy of the item, or an empty list when no item has the given id
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::vector<String> getItemHierarchy(std::size_t id) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the id of the selected item
+        /// @return Id of the selected item, or 0 when no item is selected
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getSelectedItemId() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Expands the item with the given id, together with all its parents
+        ///
+        /// @param id  Id of the item
+        ///
+        /// @return True when the item exists, false otherwise
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool expandItemById(std::size_t id);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Collapses the item with the given id
+        ///
+        /// @param id  Id of the item
+        ///
+        /// @return True when the item exists, false otherwise
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool collapseItemById(std::size_t id);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Selects the item with the given id, expanding its parents when needed
+        ///
+        /// @param id  Id of the item
+        ///
+        /// @return True when the item was selected, false when no item has the given id
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool selectItemById(std::size_t id);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes the item with the given id and all its children
+        ///
+        /// @param id  Id of the item
+        ///
+        /// @return True when the item existed and was removed, false otherwise
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool removeItemById(std::size_t id);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the selected item
         /// @return Hierarchy of items, identifying the selected node, or an empty list when no item was selected
@@ -547,6 +666,42 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         unsigned int updateVisibleNodes(std::vector<std::shared_ptr<Node>>& nodes, Node* selectedNode, float textPadding, unsigned int pos);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Positions the text of a visible node and returns where it ends
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float positionNodeText(Node& node, float textPadding);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the scrollbars after the amount of visible nodes or the width of the widest node changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateScrollbars();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Expands or collapses a node and inserts or erases its visible children without rebuilding the whole list.
+        // Returns false when nothing changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool setNodeExpanded(Node* node, bool expand);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the index of a node in the list of visible nodes, or -1 when one of its parents is collapsed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD int findVisibleNodeIndex(const Node* node) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Inserts rows in the list of visible nodes and moves the selected and hovered items below them
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void insertVisibleNodes(std::size_t index, const std::vector<std::shared_ptr<Node>>& nodes, float maxRight);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Erases rows from the list of visible nodes and moves the selected and hovered items below them
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void eraseVisibleNodes(std::size_t index, std::size_t count);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Stores the indices of the visible nodes starting from the given row in m_visibleIndexById
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVisibleNodeIndices(std::size_t first);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Updates the text colors of the selected and hovered items
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -578,6 +733,14 @@ TGUI_MODULE_EXPORT namespace tgui
         std::vector<std::shared_ptr<Node>> m_nodes;
         std::vector<std::shared_ptr<Node>> m_visibleNodes;
 
+        // Index of each visible node in m_visibleNodes, by node id. Nodes below a collapsed parent aren't in this map.
+        std::unordered_map<std::size_t, std::size_t> m_visibleIndexById;
+
+        // Nodes by their id, nodes are numbered in the order in which they were created
+        std::unordered_map<std::size_t, Node*> m_nodesById;
+        std::size_t m_nextNodeId = 1;
+        ChildrenLoader m_childrenLoader;
+
         int m_selectedItem = -1;
         int m_hoveredItem = -1;
 
@@ -26,13 +26,21 @@
 #include <TGUI/Backend/Window/Backend.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
     #include <cmath>
+    #include <limits>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    // Lines longer than this are measured without being stored, as they are unlikely to be measured again unchanged
+    static constexpr std::size_t maxCachedLineLength = 256;
+
+    // Amount of line widths that are remembered per character size before the cache is emptied
+    static constexpr std::size_t maxCachedLineWidths = 1024;
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     BackendFont::BackendFont()
@@ -77,6 +85,7 @@ namespace tgui
         {
             m_isSmooth = other.m_isSmooth;
             m_fontScale = other.m_fontScale;
+            clearMeasurementCache();
         }
 
         return *this;
@@ -90,6 +99,7 @@ namespace tgui
         {
             m_isSmooth = std::move(other.m_isSmooth);
             m_fontScale = std::move(other.m_fontScale);
+            clearMeasurementCache();
         }
 
         return *this;
@@ -133,6 +143,131 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    float BackendFont::getDistanceFieldSpread(unsigned int) const
+    {
+        return 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float BackendFont::getGlyphAdvance(char32_t codePoint, unsigned int characterSize, bool bold)
+    {
+        MeasurementTable& table = getMeasurementTable(characterSize, bold);
+        if (codePoint <= 0xFFFF)
+        {
+            auto& block = table.advanceBlocks[codePoint >> 8];
+            if (!block)
+            {
+                block = std::make_unique<std::array<float, 256>>();
+                block->fill(std::numeric_limits<float>::quiet_NaN());
+            }
+
+            float& advance = (*block)[codePoint & 0xFF];
+            if (std::isnan(advance))
+                advance = getGlyph(codePoint, characterSize, bold).advance;
+
+            return advance;
+        }
+
+        const auto it = table.advances.find(codePoint);
+        if (it != table.advances.end())
+            return it->second;
+
+        const float advance = getGlyph(codePoint, characterSize, bold).advance;
+        table.advances[codePoint] = advance;
+        return advance;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float BackendFont::getCachedKerning(char32_t first, char32_t second, unsigned int characterSize, bool bold)
+    {
+        MeasurementTable& table = getMeasurementTable(characterSize, bold);
+        const std::uint64_t key = (static_cast<std::uint64_t>(first) << 32) | second;
+        const auto it = table.kernings.find(key);
+        if (it != table.kernings.end())
+            return it->second;
+
+        const float kerning = getKerning(first, second, characterSize, bold);
+        table.kernings[key] = kerning;
+        return kerning;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float BackendFont::getLineWidth(const String& text, unsigned int characterSize, bool bold)
+    {
+        const auto lineEnd = std::find(text.begin(), text.end(), U'\n');
+        const auto lineLength = static_cast<std::size_t>(lineEnd - text.begin());
+
+        std::u32string key;
+        if (lineLength <= maxCachedLineLength)
+        {
+            MeasurementTable& table = getMeasurementTable(characterSize, bold);
+            key.assign(text.begin(), lineEnd);
+            const auto it = table.lineWidths.find(key);
+            if (it != table.lineWidths.end())
+                return it->second;
+        }
+
+        float width = 0;
+        char32_t prevChar = 0;
+        for (auto it = text.begin(); it != lineEnd; ++it)
+        {
+            const char32_t curChar = *it;
+            if (curChar == U'\r')
+                continue; // Skip carriage return characters which aren't rendered (we only use line feed characters to indicate a new line)
+
+            float charWidth;
+            if (curChar == U'\t')
+                charWidth = getGlyphAdvance(U' ', characterSize, bold) * 4.0f;
+            else
+                charWidth = getGlyphAdvance(curChar, characterSize, bold);
+
+            width += charWidth + getCachedKerning(prevChar, curChar, characterSize, bold);
+            prevChar = curChar;
+        }
+
+        if (lineLength <= maxCachedLineLength)
+        {
+            // The table is looked up again instead of keeping a reference, as loading glyphs is allowed to clear the cache
+            MeasurementTable& table = getMeasurementTable(characterSize, bold);
+            if (table.lineWidths.size() >= maxCachedLineWidths)
+                table.lineWidths.clear();
+
+            table.lineWidths.emplace(std::move(key), width);
+        }
+
+        return width;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFont::clearMeasurementCache()
+    {
+        m_measurementTables.clear();
+        m_lastMeasurementTable = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackendFont::MeasurementTable& BackendFont::getMeasurementTable(unsigned int characterSize, bool bold)
+    {
+        const std::uint32_t key = static_cast<std::uint32_t>(characterSize) | (static_cast<std::uint32_t>(bold) << 31);
+        if (m_lastMeasurementTable && (m_lastMeasurementKey == key))
+            return *m_lastMeasurementTable;
+
+        MeasurementTable& table = m_measurementTables[key];
+        if (table.advanceBlocks.empty())
+            table.advanceBlocks.resize(256);
+
+        m_lastMeasurementKey = key;
+        m_lastMeasurementTable = &table;
+        return table;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendFont::setSmooth(bool smooth)
     {
         m_isSmooth = smooth;
@@ -153,6 +288,7 @@ namespace tgui
             return;
 
         m_fontScale = scale;
+        clearMeasurementCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
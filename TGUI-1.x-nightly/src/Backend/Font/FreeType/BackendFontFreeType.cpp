@@ -39,13 +39,24 @@
 #include FT_OUTLINE_H
 #include FT_BITMAP_H
 #include FT_STROKER_H
+#include FT_MODULE_H
 
 #if defined(__GNUC__)
     #pragma GCC diagnostic pop
 #endif
 
+// FT_RENDER_MODE_SDF was added in FreeType 2.11
+#if (FREETYPE_MAJOR > 2) || ((FREETYPE_MAJOR == 2) && (FREETYPE_MINOR >= 11))
+    #define TGUI_FREETYPE_HAS_SDF 1
+#else
+    #define TGUI_FREETYPE_HAS_SDF 0
+#endif
+
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
     #include <cmath>
+    #include <cstring>
+    #include <limits>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -54,6 +65,74 @@ namespace tgui
 {
     static const float unitsPerPixel = 64; // Freetype's 26.6 pixel format uses 1/64th of a pixel as unit
 
+    static const unsigned int initialPageSize = 128;
+    static const unsigned int pageBytesPerPixel = 1 + 4; // Alpha value in memory and RGBA pixel in the texture
+
+    static const unsigned int distanceFieldReferenceSize = 48; // Character size at which distance field glyphs are rasterized
+    static const int distanceFieldSpread = 8; // Distance in pixels (at the reference size) that is covered by the distance field
+
+    static const std::uint64_t glyphCacheMagic = 0x46594C4749554754; // "TGUIGLYF" when stored in little endian
+    static const std::uint32_t glyphCacheVersion = 1;
+    static const std::uint32_t freetypeVersion = (FREETYPE_MAJOR * 10000) + (FREETYPE_MINOR * 100) + FREETYPE_PATCH;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // FNV-1a hash of the font file, which is stored in the glyph cache to detect that the cache belongs to a different font
+    TGUI_NODISCARD static std::uint64_t hashFontData(const std::uint8_t* data, std::size_t sizeInBytes)
+    {
+        std::uint64_t hash = 14695981039346656037ull;
+        for (std::size_t i = 0; i < sizeInBytes; ++i)
+        {
+            hash ^= data[i];
+            hash *= 1099511628211ull;
+        }
+
+        return hash;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Appends the bytes of a value to the glyph cache. The cache is stored in the byte order of the machine,
+    // a cache from a machine with a different byte order is rejected because its magic number won't match.
+    template <typename T>
+    static void writeGlyphCacheValue(std::vector<std::uint8_t>& data, const T& value)
+    {
+        const auto* bytes = reinterpret_cast<const std::uint8_t*>(&value);
+        data.insert(data.end(), bytes, bytes + sizeof(T));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Reads a value from the glyph cache. Returns false if the cache doesn't contain enough bytes.
+    template <typename T>
+    TGUI_NODISCARD static bool readGlyphCacheValue(const std::uint8_t*& data, const std::uint8_t* dataEnd, T& value)
+    {
+        if (static_cast<std::size_t>(dataEnd - data) < sizeof(T))
+            return false;
+
+        std::memcpy(&value, data, sizeof(T));
+        data += sizeof(T);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Converts the alpha values inside the rect to white RGBA pixels, which is the format that the backend textures use
+    static void copyAlphaToRGBA(const std::uint8_t* alphaPixels, unsigned int textureSize, const UIntRect& rect, std::uint8_t* rgbaPixels)
+    {
+        for (unsigned int y = rect.top; y < rect.top + rect.height; ++y)
+        {
+            const std::uint8_t* alphaPtr = &alphaPixels[(y * textureSize) + rect.left];
+            for (unsigned int x = 0; x < rect.width; ++x)
+            {
+                *rgbaPixels++ = 255;
+                *rgbaPixels++ = 255;
+                *rgbaPixels++ = 255;
+                *rgbaPixels++ = *alphaPtr++;
+            }
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     BackendFontFreetype::~BackendFontFreetype()
@@ -66,42 +145,14 @@ namespace tgui
     bool BackendFontFreetype::loadFromMemory(std::unique_ptr<std::uint8_t[]> data, std::size_t sizeInBytes)
     {
         cleanup();
+        clearMeasurementCache();
         m_cachedLineSpacing.clear();
         m_cachedFontHeights.clear();
         m_cachedAscents.clear();
         m_cachedDescents.clear();
-        m_glyphs.clear();
-        m_rows.clear();
-        m_pixels = nullptr;
-        m_texture = nullptr;
-        m_textureSize = 0;
+        m_pages.clear();
+        m_atlasStatistics = {};
         m_textureVersion = 0;
-        m_nextRow = 3; // First 2 rows contain pixels for underlining
-
-        constexpr unsigned int initialTextureSize = 128;
-        m_pixels = MakeUniqueForOverwrite<std::uint8_t[]>(initialTextureSize * initialTextureSize * 4);
-
-        std::uint8_t* pixelPtr = m_pixels.get();
-        for (unsigned int y = 0; y < initialTextureSize; ++y)
-        {
-            for (unsigned int x = 0; x < initialTextureSize; ++x)
-            {
-                // Color is always white, alpha channel contains whether the pixel is empty of not
-                *pixelPtr++ = 255;
-                *pixelPtr++ = 255;
-                *pixelPtr++ = 255;
-                *pixelPtr++ = 0;
-            }
-        }
-
-        // Reserve a 2x2 white square in the top left corner of the texture that we can use for drawing an underline
-        for (unsigned int y = 0; y < 2; ++y)
-        {
-            for (unsigned int x = 0; x < 2; ++x)
-                m_pixels[((initialTextureSize * y) + x) * 4 + 3] = 255;
-        }
-
-        m_textureSize = initialTextureSize;
 
         // Initialize the freetype library each time, since we currently don't reuse the library object between fonts.
         FT_Library library;
@@ -124,7 +175,15 @@ namespace tgui
             throw Exception{U"Failed to select font character map"};
         }
 
+#if TGUI_FREETYPE_HAS_SDF
+        // The default spread of FreeType is too small to draw outlines with the distance field
+        FT_Int spread = distanceFieldSpread;
+        FT_Property_Set(library, "bsdf", "spread", &spread);
+#endif
+
         m_fileContents = std::move(data);
+        m_fileSize = sizeInBytes;
+        m_fontHashCalculated = false;
         m_library = library;
         m_face = face;
         return true;
@@ -161,13 +220,18 @@ namespace tgui
         if ((first == 0) || (second == 0))
             return 0;
 
-        if (!m_face || !setCurrentSize(characterSize))
+        if (!m_face)
             return 0;
 
         // Retrieve position compensation deltas generated by FT_LOAD_FORCE_AUTOHINT flag
         const float firstRsbDelta = getInternalGlyph(first, characterSize, bold, 0).rsbDelta;
         const float secondLsbDelta = getInternalGlyph(second, characterSize, bold, 0).lsbDelta;
 
+        // Loading a glyph may have changed the size of the face (distance field glyphs are loaded at the reference size),
+        // so the size is only selected once the glyphs are available
+        if (!setCurrentSize(characterSize))
+            return 0;
+
         // Get the kerning vector if present
         FT_Vector kerning;
         kerning.x = kerning.y = 0;
@@ -304,26 +368,37 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    std::shared_ptr<BackendTexture> BackendFontFreetype::getTexture(unsigned int, unsigned int& textureVersion)
+    std::shared_ptr<BackendTexture> BackendFontFreetype::getTexture(unsigned int characterSize, unsigned int& textureVersion)
     {
-        if (m_texture)
+        GlyphPage& page = getPage(characterSize);
+
+        // Glyphs that were added since the last call only need their own part of the texture to be uploaded.
+        // The texture coordinates of the other glyphs remain the same, so the texture version doesn't change.
+        if (page.texture && uploadDirtyRects(page))
         {
-            textureVersion = m_textureVersion;
-            return m_texture;
+            textureVersion = page.textureVersion;
+            return page.texture;
         }
 
-        m_texture = getBackend()->getRenderer()->createTexture();
-        m_texture->loadTextureOnly({m_textureSize, m_textureSize}, m_pixels.get(), m_isSmooth);
+        const UIntRect fullRect{0, 0, page.textureSize, page.textureSize};
+        auto pixels = MakeUniqueForOverwrite<std::uint8_t[]>(page.textureSize * page.textureSize * 4);
+        copyAlphaToRGBA(page.pixels.get(), page.textureSize, fullRect, pixels.get());
 
-        textureVersion = ++m_textureVersion;
-        return m_texture;
+        page.texture = getBackend()->getRenderer()->createTexture();
+        page.texture->loadTextureOnly({page.textureSize, page.textureSize}, pixels.get(), m_isSmooth);
+        page.dirtyRects.clear();
+
+        page.textureVersion = ++m_textureVersion;
+        textureVersion = page.textureVersion;
+        return page.texture;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Vector2u BackendFontFreetype::getTextureSize(unsigned int)
+    Vector2u BackendFontFreetype::getTextureSize(unsigned int characterSize)
     {
-        return {m_textureSize, m_textureSize};
+        const GlyphPage& page = getPage(characterSize);
+        return {page.textureSize, page.textureSize};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -331,8 +406,11 @@ namespace tgui
     void BackendFontFreetype::setSmooth(bool smooth)
     {
         BackendFont::setSmooth(smooth);
-        if (m_texture)
-            m_texture->setSmooth(m_isSmooth);
+        for (auto& pair : m_pages)
+        {
+            if (pair.second.texture)
+                pair.second.texture->setSmooth(m_isSmooth);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -344,19 +422,268 @@ namespace tgui
 
         BackendFont::setFontScale(scale);
 
-        // Destroy the texture to force texts to update their glyphs
-        m_texture = nullptr;
+        // The pages are stored per scaled character size, so texts will switch to different pages and update their glyphs.
+        // The old pages won't be used anymore.
+        m_pages.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float BackendFontFreetype::getDistanceFieldSpread(unsigned int characterSize) const
+    {
+        if (!usesDistanceField())
+            return 0;
+
+        return static_cast<float>(distanceFieldSpread * characterSize) / distanceFieldReferenceSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::setDistanceFieldRendering(bool distanceField)
+    {
+#if TGUI_FREETYPE_HAS_SDF
+        if (m_distanceField == distanceField)
+            return;
+
+        m_distanceField = distanceField;
+
+        // The pages will be created again with the other kind of glyphs, which gives texts a new texture version
+        m_pages.clear();
+        clearMeasurementCache();
+#else
+        (void)distanceField;
+#endif
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontFreetype::getDistanceFieldRendering() const
+    {
+        return m_distanceField;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::setAtlasMemoryBudget(std::size_t bytes)
+    {
+        m_atlasMemoryBudget = bytes;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t BackendFontFreetype::getAtlasMemoryBudget() const
+    {
+        return m_atlasMemoryBudget;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    GlyphAtlasStatistics BackendFontFreetype::getAtlasStatistics() const
+    {
+        GlyphAtlasStatistics statistics = m_atlasStatistics;
+        statistics.pages = m_pages.size();
+        statistics.memoryUsage = getPagesMemoryUsage();
+        return statistics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::prewarmGlyphs(const String& characters, const std::vector<unsigned int>& characterSizes, bool bold)
+    {
+        if (!m_face)
+            return;
+
+        for (const unsigned int characterSize : characterSizes)
+        {
+            for (const char32_t codePoint : characters)
+                (void)getInternalGlyph(codePoint, characterSize, bold, 0);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontFreetype::saveGlyphCache(const String& filename) const
+    {
+        if (!m_face)
+            return false;
+
+        std::vector<std::uint8_t> data;
+        writeGlyphCacheValue(data, glyphCacheMagic);
+        writeGlyphCacheValue(data, glyphCacheVersion);
+        writeGlyphCacheValue(data, getFontHash());
+        writeGlyphCacheValue(data, freetypeVersion);
+        writeGlyphCacheValue(data, static_cast<std::uint8_t>(usesDistanceField()));
+
+        std::uint32_t pageCount = 0;
+        for (const auto& pair : m_pages)
+        {
+            if (pair.second.pixels)
+                ++pageCount;
+        }
+        writeGlyphCacheValue(data, pageCount);
+
+        for (const auto& pair : m_pages)
+        {
+            const GlyphPage& page = pair.second;
+            if (!page.pixels)
+                continue;
+
+            writeGlyphCacheValue(data, static_cast<std::uint32_t>(pair.first));
+            writeGlyphCacheValue(data, static_cast<std::uint32_t>(page.textureSize));
+
+            writeGlyphCacheValue(data, static_cast<std::uint32_t>(page.skyline.size()));
+            for (const auto& node : page.skyline)
+            {
+                writeGlyphCacheValue(data, static_cast<std::uint32_t>(node.x));
+                writeGlyphCacheValue(data, static_cast<std::uint32_t>(node.y));
+                writeGlyphCacheValue(data, static_cast<std::uint32_t>(node.width));
+            }
+
+            writeGlyphCacheValue(data, static_cast<std::uint32_t>(page.glyphs.size()));
+            for (const auto& glyphPair : page.glyphs)
+            {
+                const Glyph& glyph = glyphPair.second;
+                writeGlyphCacheValue(data, glyphPair.first);
+                writeGlyphCacheValue(data, glyph.advance);
+                writeGlyphCacheValue(data, glyph.lsbDelta);
+                writeGlyphCacheValue(data, glyph.rsbDelta);
+                writeGlyphCacheValue(data, glyph.bounds.left);
+                writeGlyphCacheValue(data, glyph.bounds.top);
+                writeGlyphCacheValue(data, glyph.bounds.width);
+                writeGlyphCacheValue(data, glyph.bounds.height);
+                writeGlyphCacheValue(data, static_cast<std::uint32_t>(glyph.textureRect.left));
+                writeGlyphCacheValue(data, static_cast<std::uint32_t>(glyph.textureRect.top));
+                writeGlyphCacheValue(data, static_cast<std::uint32_t>(glyph.textureRect.width));
+                writeGlyphCacheValue(data, static_cast<std::uint32_t>(glyph.textureRect.height));
+            }
+
+            data.insert(data.end(), page.pixels.get(), page.pixels.get() + static_cast<std::size_t>(page.textureSize) * page.textureSize);
+        }
+
+        return writeMemoryToFile(filename, data.data(), data.size());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontFreetype::loadGlyphCache(const String& filename)
+    {
+        if (!m_face)
+            return false;
+
+        // The whole cache is read at once, the pages are then copied out of it
+        std::size_t fileSize = 0;
+        const auto fileContents = readFileToMemory(filename, fileSize);
+        if (!fileContents)
+            return false;
+
+        const std::uint8_t* data = fileContents.get();
+        const std::uint8_t* const dataEnd = data + fileSize;
+
+        std::uint64_t magic;
+        std::uint32_t version;
+        std::uint64_t fontHash;
+        std::uint32_t cacheFreetypeVersion;
+        std::uint8_t distanceField;
+        std::uint32_t pageCount;
+        if (!readGlyphCacheValue(data, dataEnd, magic) || (magic != glyphCacheMagic)
+         || !readGlyphCacheValue(data, dataEnd, version) || (version != glyphCacheVersion)
+         || !readGlyphCacheValue(data, dataEnd, fontHash) || (fontHash != getFontHash())
+         || !readGlyphCacheValue(data, dataEnd, cacheFreetypeVersion) || (cacheFreetypeVersion != freetypeVersion)
+         || !readGlyphCacheValue(data, dataEnd, distanceField) || ((distanceField != 0) != usesDistanceField())
+         || !readGlyphCacheValue(data, dataEnd, pageCount))
+            return false;
+
+        std::unordered_map<unsigned int, GlyphPage> pages;
+        std::size_t memoryUsage = 0;
+        for (std::uint32_t pageIndex = 0; pageIndex < pageCount; ++pageIndex)
+        {
+            std::uint32_t pageKey;
+            std::uint32_t textureSize;
+            std::uint32_t nodeCount;
+            if (!readGlyphCacheValue(data, dataEnd, pageKey) || !readGlyphCacheValue(data, dataEnd, textureSize)
+             || (textureSize < initialPageSize) || (textureSize > 32768)
+             || !readGlyphCacheValue(data, dataEnd, nodeCount))
+                return false;
+
+            GlyphPage page;
+            page.textureSize = textureSize;
+            for (std::uint32_t i = 0; i < nodeCount; ++i)
+            {
+                SkylineNode node;
+                if (!readGlyphCacheValue(data, dataEnd, node.x) || !readGlyphCacheValue(data, dataEnd, node.y)
+                 || !readGlyphCacheValue(data, dataEnd, node.width)
+                 || (node.x > textureSize) || (node.width > textureSize - node.x) || (node.y > textureSize))
+                    return false;
+
+                page.skyline.push_back(node);
+            }
+
+            std::uint32_t glyphCount;
+            if (!readGlyphCacheValue(data, dataEnd, glyphCount))
+                return false;
+
+            for (std::uint32_t i = 0; i < glyphCount; ++i)
+            {
+                std::uint64_t glyphKey;
+                Glyph glyph;
+                std::uint32_t rect[4];
+                if (!readGlyphCacheValue(data, dataEnd, glyphKey)
+                 || !readGlyphCacheValue(data, dataEnd, glyph.advance)
+                 || !readGlyphCacheValue(data, dataEnd, glyph.lsbDelta)
+                 || !readGlyphCacheValue(data, dataEnd, glyph.rsbDelta)
+                 || !readGlyphCacheValue(data, dataEnd, glyph.bounds.left)
+                 || !readGlyphCacheValue(data, dataEnd, glyph.bounds.top)
+                 || !readGlyphCacheValue(data, dataEnd, glyph.bounds.width)
+                 || !readGlyphCacheValue(data, dataEnd, glyph.bounds.height)
+                 || !readGlyphCacheValue(data, dataEnd, rect))
+                    return false;
+
+                if ((rect[0] > textureSize) || (rect[2] > textureSize - rect[0]) || (rect[1] > textureSize) || (rect[3] > textureSize - rect[1]))
+                    return false;
+
+                glyph.textureRect = {rect[0], rect[1], rect[2], rect[3]};
+                page.glyphs.emplace(glyphKey, glyph);
+            }
+
+            const std::size_t pixelCount = static_cast<std::size_t>(textureSize) * textureSize;
+            if (static_cast<std::size_t>(dataEnd - data) < pixelCount)
+                return false;
+
+            // Pages that don't fit in the memory budget are skipped, their glyphs will be loaded again when needed
+            const std::size_t pageMemory = pixelCount * pageBytesPerPixel;
+            if (memoryUsage + pageMemory <= m_atlasMemoryBudget)
+            {
+                page.pixels = MakeUniqueForOverwrite<std::uint8_t[]>(pixelCount);
+                std::memcpy(page.pixels.get(), data, pixelCount);
+                page.lastUsed = ++m_pageUseCounter;
+                pages[pageKey] = std::move(page);
+                memoryUsage += pageMemory;
+            }
+
+            data += pixelCount;
+        }
+
+        // The textures are created again when the pages are used, with a new texture version so that texts update their glyphs
+        m_pages = std::move(pages);
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    BackendFontFreetype::Glyph BackendFontFreetype::loadGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness)
+    BackendFontFreetype::Glyph BackendFontFreetype::loadGlyph(GlyphPage& page, char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness)
     {
         Glyph glyph;
         if (!m_face)
             return glyph;
 
-        if (!setCurrentSize(characterSize))
+        // Distance field glyphs are loaded at the reference size, which isn't affected by the font scale
+        const bool distanceField = usesDistanceField();
+        if (distanceField)
+        {
+            if (FT_Set_Pixel_Sizes(m_face, 0, characterSize) != FT_Err_Ok)
+                return glyph;
+        }
+        else if (!setCurrentSize(characterSize))
             return glyph;
 #if defined(__GNUC__)
     #pragma GCC diagnostic push
@@ -372,6 +699,20 @@ namespace tgui
         if (FT_Load_Char(m_face, codePoint, flags) != 0)
             return glyph;
 
+        const FT_Pos boldWeight = 1 << 6;
+#if TGUI_FREETYPE_HAS_SDF
+        if (distanceField)
+        {
+            if (bold && (m_face->glyph->format == FT_GLYPH_FORMAT_OUTLINE))
+                FT_Outline_Embolden(&m_face->glyph->outline, boldWeight);
+
+            // Rasterizing the glyph before creating the distance field makes FreeType use its bitmap based generator,
+            // which unlike the outline based one can handle overlapping contours.
+            if ((FT_Render_Glyph(m_face->glyph, FT_RENDER_MODE_NORMAL) != 0) || (FT_Render_Glyph(m_face->glyph, FT_RENDER_MODE_SDF) != 0))
+                return glyph;
+        }
+#endif
+
         // Retrieve the glyph
         FT_Glyph glyphDesc;
         if (FT_Get_Glyph(m_face->glyph, &glyphDesc) != 0)
@@ -392,7 +733,6 @@ namespace tgui
         }
 
         // Apply the bold style if requested and outlines are supported
-        const FT_Pos boldWeight = 1 << 6;
         const bool outlineSupport = (glyphDesc->format == FT_GLYPH_FORMAT_OUTLINE);
         if (bold && outlineSupport)
         {
@@ -412,7 +752,7 @@ namespace tgui
 
         // If bold was requested but the font didn't support outlines then apply bold here using a different (lower quality) method.
         // We have to cache the outline support bool because FT_Glyph_To_Bitmap changes format to FT_GLYPH_FORMAT_BITMAP.
-        if (bold && !outlineSupport)
+        if (bold && !outlineSupport && !distanceField)
             FT_Bitmap_Embolden(static_cast<FT_Library>(m_library), &bitmap, boldWeight, boldWeight);
 
         // Bit shift is possible without loss because we use FT_LOAD_FORCE_AUTOHINT flag
@@ -439,11 +779,17 @@ namespace tgui
         // Find a good position for the new glyph into the texture.
         // We leave a small padding around characters, so that filtering doesn't pollute them with pixels from neighbors.
         const unsigned int padding = 2;
-        glyph.textureRect = findAvailableGlyphRect(bitmap.width + (2 * padding), bitmap.rows + (2 * padding));
-        glyph.textureRect.left += padding;
-        glyph.textureRect.top += padding;
-        glyph.textureRect.width -= 2 * padding;
-        glyph.textureRect.height -= 2 * padding;
+        const UIntRect rect = findAvailableGlyphRect(page, bitmap.width + (2 * padding), bitmap.rows + (2 * padding));
+        if ((rect.width == 0) || (rect.height == 0))
+        {
+            // The glyph is too large to ever fit in the texture. It keeps its advance but isn't drawn, like a space character.
+            glyph.bounds.width = 0;
+            glyph.bounds.height = 0;
+            FT_Done_Glyph(glyphDesc);
+            return glyph;
+        }
+
+        glyph.textureRect = {rect.left + padding, rect.top + padding, rect.width - (2 * padding), rect.height - (2 * padding)};
 
         // Extract the glyph's pixels from the bitmap
         const std::uint8_t* glyphBitmapPixels = bitmap.buffer;
@@ -454,9 +800,8 @@ namespace tgui
             {
                 for (unsigned int x = 0; x < bitmap.width; ++x)
                 {
-                    // The color channels remain white, just fill the alpha channel
-                    const std::size_t index = (glyph.textureRect.left + x) + (glyph.textureRect.top + y) * m_textureSize;
-                    m_pixels[index * 4 + 3] = ((glyphBitmapPixels[(static_cast<int>(y) * bitmap.pitch) + static_cast<int>(x / 8)]) & (1 << (7 - (x % 8)))) ? 255 : 0;
+                    const std::size_t index = (glyph.textureRect.left + x) + (glyph.textureRect.top + y) * page.textureSize;
+                    page.pixels[index] = ((glyphBitmapPixels[(static_cast<int>(y) * bitmap.pitch) + static_cast<int>(x / 8)]) & (1 << (7 - (x % 8)))) ? 255 : 0;
                 }
             }
         }
@@ -467,15 +812,14 @@ namespace tgui
             {
                 for (unsigned int x = 0; x < bitmap.width; ++x)
                 {
-                    // The color channels remain white, just fill the alpha channel
-                    const std::size_t index = (glyph.textureRect.left + x) + (glyph.textureRect.top + y) * m_textureSize;
-                    m_pixels[index * 4 + 3] = glyphBitmapPixels[(static_cast<int>(y) * bitmap.pitch) + static_cast<int>(x)];
+                    const std::size_t index = (glyph.textureRect.left + x) + (glyph.textureRect.top + y) * page.textureSize;
+                    page.pixels[index] = glyphBitmapPixels[(static_cast<int>(y) * bitmap.pitch) + static_cast<int>(x)];
                 }
             }
         }
 
-        // We will have to recreate the texture now that the pixels changed
-        m_texture = nullptr;
+        // Only the part of the texture with the new glyph has to be updated
+        addDirtyRect(page, glyph.textureRect);
 
         FT_Done_Glyph(glyphDesc);
         return glyph;
@@ -485,98 +829,362 @@ namespace tgui
 
     BackendFontFreetype::Glyph BackendFontFreetype::getInternalGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness)
     {
+        if (usesDistanceField())
+            return getDistanceFieldGlyph(codePoint, characterSize, bold);
+
         const std::uint64_t glyphKey = constructGlyphKey(codePoint, static_cast<unsigned int>(characterSize * m_fontScale),
                                                          bold, outlineThickness * m_fontScale);
 
-        const auto it = m_glyphs.find(glyphKey);
-        if (it != m_glyphs.end())
+        GlyphPage& page = getPage(characterSize);
+        const auto it = page.glyphs.find(glyphKey);
+        if (it != page.glyphs.end())
+        {
+            ++m_atlasStatistics.glyphHits;
             return it->second;
+        }
 
-        const Glyph& glyph = loadGlyph(codePoint, characterSize, bold, outlineThickness);
-        return m_glyphs.insert({glyphKey, glyph}).first->second;
+        ++m_atlasStatistics.glyphMisses;
+        const Glyph& glyph = loadGlyph(page, codePoint, characterSize, bold, outlineThickness);
+        return page.glyphs.insert({glyphKey, glyph}).first->second;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    UIntRect BackendFontFreetype::findAvailableGlyphRect(unsigned int width, unsigned int height)
+    BackendFontFreetype::Glyph BackendFontFreetype::getDistanceFieldGlyph(char32_t codePoint, unsigned int characterSize, bool bold)
     {
-        // Find the line that where the glyph fits well.
-        // This is based on the sf::Font class in the SFML library. It might not be the most optimal method, but it is good enough for now.
-        Row* bestRow = nullptr;
-        float bestRatio = 0;
-        for (auto& row : m_rows)
+        // All character sizes share the same glyph, so the key doesn't contain the size. Outlines are added by the shader.
+        const std::uint64_t glyphKey = constructGlyphKey(codePoint, distanceFieldReferenceSize, bold, 0);
+
+        GlyphPage& page = getPage(characterSize);
+        auto it = page.glyphs.find(glyphKey);
+        if (it != page.glyphs.end())
+            ++m_atlasStatistics.glyphHits;
+        else
         {
-            float ratio = static_cast<float>(height) / row.height;
+            ++m_atlasStatistics.glyphMisses;
+            it = page.glyphs.insert({glyphKey, loadGlyph(page, codePoint, distanceFieldReferenceSize, bold, 0)}).first;
+        }
 
-            // Ignore rows that are either too small or too high
-            if ((ratio < 0.7f) || (ratio > 1.f))
-                continue;
+        // Scale the metrics from the reference size to the requested size, the texture rect remains the same
+        const float scale = (characterSize * m_fontScale) / distanceFieldReferenceSize;
+        Glyph glyph = it->second;
+        glyph.advance *= scale;
+        glyph.lsbDelta *= scale;
+        glyph.rsbDelta *= scale;
+        glyph.bounds = {glyph.bounds.getPosition() * scale, glyph.bounds.getSize() * scale};
+        return glyph;
+    }
 
-            // Check if there's enough horizontal space left in the row
-            if (width > m_textureSize - row.width)
-                continue;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            // Make sure that this new row is the best found so far
-            if (ratio < bestRatio)
-                continue;
+    BackendFontFreetype::GlyphPage& BackendFontFreetype::getPage(unsigned int characterSize)
+    {
+        // In distance field mode there is only a single page that is shared by all character sizes
+        const auto scaledCharacterSize = usesDistanceField() ? 0 : static_cast<unsigned int>(characterSize * m_fontScale);
 
-            // The current row passed all the tests: we can select it
-            bestRow = &row;
-            bestRatio = ratio;
+        GlyphPage& page = m_pages[scaledCharacterSize];
+        page.lastUsed = ++m_pageUseCounter;
+        if (!page.pixels)
+        {
+            evictPages(page, initialPageSize * initialPageSize * pageBytesPerPixel);
+            resetPage(page);
         }
 
-        // If we didn't find a matching row, create a new one (10% taller than the glyph)
-        if (!bestRow)
+        return page;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::resetPage(GlyphPage& page)
+    {
+        // Only the alpha channel is stored, the color is always white
+        page.textureSize = initialPageSize;
+        page.pixels = MakeUniqueForOverwrite<std::uint8_t[]>(initialPageSize * initialPageSize);
+        std::memset(page.pixels.get(), 0, initialPageSize * initialPageSize);
+
+        // Reserve a 2x2 white square in the top left corner of the texture that we can use for drawing an underline.
+        // The first 3 rows are kept free for it, so that filtering doesn't mix the square with the glyphs.
+        for (unsigned int y = 0; y < 2; ++y)
+        {
+            for (unsigned int x = 0; x < 2; ++x)
+                page.pixels[(initialPageSize * y) + x] = 255;
+        }
+
+        page.skyline.clear();
+        page.skyline.push_back({0, 3, initialPageSize});
+
+        // The texture is recreated with a new version, so that texts know that their glyphs are gone
+        page.glyphs.clear();
+        page.texture = nullptr;
+        page.dirtyRects.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    UIntRect BackendFontFreetype::findAvailableGlyphRect(GlyphPage& page, unsigned int width, unsigned int height)
+    {
+        // A rect that doesn't fit in an empty page of the largest possible size can't be stored at all.
+        // The first 3 rows of a page are reserved for the white square.
+        const unsigned int maxPageSize = getMaximumPageSize();
+        if ((width > maxPageSize) || (height + 3 > maxPageSize))
+            return {};
+
+        // Skyline bottom-left packing: the rect is placed at the lowest available position, which wastes less space than
+        // placing glyphs in rows with a fixed height when glyphs of different heights are mixed (e.g. latin and CJK text).
+        bool pageWasReset = false;
+        while (true)
         {
-            // Check if the glyph can fit in the texture and resize the texture otherwise
-            const unsigned int rowHeight = height + (height / 10);
-            while ((m_nextRow + rowHeight >= m_textureSize) || (width >= m_textureSize))
+            std::size_t bestIndex = page.skyline.size();
+            unsigned int bestBottom = 0;
+            unsigned int bestWidth = 0;
+            unsigned int bestY = 0;
+            for (std::size_t i = 0; i < page.skyline.size(); ++i)
             {
-                /// TODO: Check if maximum texture size is reached and use multiple textures if there isn't enough space left
+                unsigned int y;
+                if (!skylineFits(page, i, width, height, y))
+                    continue;
 
-                // Copy existing pixels to the top left quadrant
-                auto pixels = MakeUniqueForOverwrite<std::uint8_t[]>((m_textureSize * 2) * (m_textureSize * 2) * 4);
-                for (unsigned int y = 0; y < m_textureSize; ++y)
-                    std::memcpy(&pixels[y * (2 * m_textureSize) * 4], &m_pixels[y * m_textureSize * 4], m_textureSize * 4);
+                // Prefer the lowest position, and the narrowest node when positions are equal so that wide gaps remain available
+                if ((bestIndex == page.skyline.size()) || (y + height < bestBottom)
+                 || ((y + height == bestBottom) && (page.skyline[i].width < bestWidth)))
+                {
+                    bestIndex = i;
+                    bestBottom = y + height;
+                    bestWidth = page.skyline[i].width;
+                    bestY = y;
+                }
+            }
+
+            if (bestIndex < page.skyline.size())
+            {
+                const UIntRect rect{page.skyline[bestIndex].x, bestY, width, height};
 
-                // Top right quadrant and bottom halves are filled with empty values
-                // Color is always white, alpha channel contains whether the pixel is empty of not
-                for (unsigned int y = 0; y < m_textureSize; ++y)
+                // The new node covers the rect, the nodes below it are shortened or removed
+                page.skyline.insert(page.skyline.begin() + static_cast<std::ptrdiff_t>(bestIndex), {rect.left, rect.top + rect.height, rect.width});
+                for (std::size_t i = bestIndex + 1; i < page.skyline.size(); )
                 {
-                    std::uint8_t* pixelPtr = &pixels[((y * (2 * m_textureSize)) + m_textureSize) * 4];
-                    for (unsigned int i = 0; i < m_textureSize; ++i)
+                    const unsigned int previousRight = page.skyline[i-1].x + page.skyline[i-1].width;
+                    if (page.skyline[i].x >= previousRight)
+                        break;
+
+                    const unsigned int shrink = previousRight - page.skyline[i].x;
+                    if (page.skyline[i].width > shrink)
                     {
-                        *pixelPtr++ = 255;
-                        *pixelPtr++ = 255;
-                        *pixelPtr++ = 255;
-                        *pixelPtr++ = 0;
+                        page.skyline[i].x += shrink;
+                        page.skyline[i].width -= shrink;
+                        break;
                     }
+
+                    page.skyline.erase(page.skyline.begin() + static_cast<std::ptrdiff_t>(i));
                 }
-                std::uint8_t* pixelPtr = &pixels[m_textureSize * (2 * m_textureSize) * 4];
-                for (unsigned int i = 0; i < (2 * m_textureSize) * m_textureSize; ++i)
+
+                // Neighbors at the same height are merged to keep the skyline short
+                for (std::size_t i = 1; i < page.skyline.size(); )
                 {
-                    *pixelPtr++ = 255;
-                    *pixelPtr++ = 255;
-                    *pixelPtr++ = 255;
-                    *pixelPtr++ = 0;
+                    if (page.skyline[i-1].y == page.skyline[i].y)
+                    {
+                        page.skyline[i-1].width += page.skyline[i].width;
+                        page.skyline.erase(page.skyline.begin() + static_cast<std::ptrdiff_t>(i));
+                    }
+                    else
+                        ++i;
                 }
 
-                m_pixels = std::move(pixels);
-                m_textureSize *= 2;
+                return rect;
+            }
+
+            if (!growPage(page))
+            {
+                // If the rect didn't even fit after starting over with an empty page then resetting again won't help
+                if (pageWasReset)
+                    return {};
+
+                // The page can't become larger, so all glyphs are removed to make room for the ones that are still in use
+                resetPage(page);
+                ++m_atlasStatistics.pageResets;
+                pageWasReset = true;
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontFreetype::skylineFits(const GlyphPage& page, std::size_t nodeIndex, unsigned int width, unsigned int height, unsigned int& y)
+    {
+        const unsigned int x = page.skyline[nodeIndex].x;
+        if (x + width > page.textureSize)
+            return false;
+
+        // The rect has to lie above all nodes that it covers
+        y = 0;
+        unsigned int widthLeft = width;
+        for (std::size_t i = nodeIndex; widthLeft > 0; ++i)
+        {
+            if (i >= page.skyline.size())
+                return false;
+
+            y = std::max(y, page.skyline[i].y);
+            if (y + height > page.textureSize)
+                return false;
+
+            widthLeft -= std::min(widthLeft, page.skyline[i].width);
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontFreetype::growPage(GlyphPage& page)
+    {
+        const unsigned int newSize = page.textureSize * 2;
+        if (isBackendSet() && getBackend()->hasRenderer() && (newSize > getBackend()->getRenderer()->getMaximumTextureSize()))
+            return false;
+
+        // Try to make room in the memory budget by removing other pages
+        const std::size_t extraBytes = (static_cast<std::size_t>(newSize) * newSize - static_cast<std::size_t>(page.textureSize) * page.textureSize) * pageBytesPerPixel;
+        evictPages(page, extraBytes);
+        if (getPagesMemoryUsage() + extraBytes > m_atlasMemoryBudget)
+            return false;
+
+        // Copy existing pixels to the top left quadrant, the rest of the new texture is empty
+        auto pixels = MakeUniqueForOverwrite<std::uint8_t[]>(static_cast<std::size_t>(newSize) * newSize);
+        std::memset(pixels.get(), 0, static_cast<std::size_t>(newSize) * newSize);
+        for (unsigned int y = 0; y < page.textureSize; ++y)
+            std::memcpy(&pixels[y * newSize], &page.pixels[y * page.textureSize], page.textureSize);
+
+        // The area on the right of the old texture is completely free
+        page.skyline.push_back({page.textureSize, 0, newSize - page.textureSize});
+
+        page.pixels = std::move(pixels);
+        page.textureSize = newSize;
+
+        // The texture has a different size now, so it has to be recreated with all pixels
+        page.texture = nullptr;
+        page.dirtyRects.clear();
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int BackendFontFreetype::getMaximumPageSize() const
+    {
+        unsigned int maxTextureSize = std::numeric_limits<unsigned int>::max();
+        if (isBackendSet() && getBackend()->hasRenderer())
+            maxTextureSize = getBackend()->getRenderer()->getMaximumTextureSize();
+
+        // All other pages can be evicted, so a single page may use the entire memory budget
+        unsigned int size = initialPageSize;
+        while ((size <= maxTextureSize / 2)
+            && (static_cast<std::size_t>(size * 2) * (size * 2) * pageBytesPerPixel <= m_atlasMemoryBudget))
+        {
+            size *= 2;
+        }
+
+        return size;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::evictPages(const GlyphPage& pageToKeep, std::size_t extraBytes)
+    {
+        while (getPagesMemoryUsage() + extraBytes > m_atlasMemoryBudget)
+        {
+            auto leastRecentlyUsedIt = m_pages.end();
+            for (auto it = m_pages.begin(); it != m_pages.end(); ++it)
+            {
+                if ((&it->second == &pageToKeep) || !it->second.pixels)
+                    continue;
+
+                if ((leastRecentlyUsedIt == m_pages.end()) || (it->second.lastUsed < leastRecentlyUsedIt->second.lastUsed))
+                    leastRecentlyUsedIt = it;
             }
 
-            // We can now create the new row
-            m_rows.emplace_back(m_nextRow, rowHeight);
-            m_nextRow += rowHeight;
-            bestRow = &m_rows.back();
+            if (leastRecentlyUsedIt == m_pages.end())
+                return;
+
+            m_pages.erase(leastRecentlyUsedIt);
+            ++m_atlasStatistics.pageEvictions;
         }
+    }
 
-        // Find the glyph's rectangle on the selected row
-        UIntRect rect{bestRow->width, bestRow->top, width, height};
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t BackendFontFreetype::getPagesMemoryUsage() const
+    {
+        std::size_t bytes = 0;
+        for (const auto& pair : m_pages)
+        {
+            if (pair.second.pixels)
+                bytes += static_cast<std::size_t>(pair.second.textureSize) * pair.second.textureSize * pageBytesPerPixel;
+        }
+
+        return bytes;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::addDirtyRect(GlyphPage& page, const UIntRect& rect)
+    {
+        // There is no need to track changes when the texture will be created from scratch anyway
+        if (!page.texture)
+            return;
+
+        // Glyphs are often placed next to each other, in which case they are merged into a single rect to reduce the amount of
+        // uploads. Rects are only merged when this doesn't cause much more pixels to be uploaded than the ones that changed.
+        for (auto& dirtyRect : page.dirtyRects)
+        {
+            const unsigned int left = std::min(dirtyRect.left, rect.left);
+            const unsigned int top = std::min(dirtyRect.top, rect.top);
+            const unsigned int right = std::max(dirtyRect.left + dirtyRect.width, rect.left + rect.width);
+            const unsigned int bottom = std::max(dirtyRect.top + dirtyRect.height, rect.top + rect.height);
+            const std::size_t mergedArea = static_cast<std::size_t>(right - left) * (bottom - top);
+            const std::size_t separateArea = static_cast<std::size_t>(dirtyRect.width) * dirtyRect.height + static_cast<std::size_t>(rect.width) * rect.height;
+            if (mergedArea > 2 * separateArea)
+                continue;
+
+            dirtyRect = {left, top, right - left, bottom - top};
+            return;
+        }
+
+        page.dirtyRects.push_back(rect);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontFreetype::uploadDirtyRects(GlyphPage& page)
+    {
+        for (const auto& rect : page.dirtyRects)
+        {
+            m_uploadPixels.resize(static_cast<std::size_t>(rect.width) * rect.height * 4);
+            copyAlphaToRGBA(page.pixels.get(), page.textureSize, rect, m_uploadPixels.data());
+            if (!page.texture->updatePixels(rect, m_uploadPixels.data()))
+                return false;
+        }
+
+        page.dirtyRects.clear();
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontFreetype::usesDistanceField() const
+    {
+        // Bitmap fonts can't be rasterized at the reference size
+        return m_distanceField && m_face && FT_IS_SCALABLE(m_face);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::uint64_t BackendFontFreetype::getFontHash() const
+    {
+        if (!m_fontHashCalculated)
+        {
+            m_fontHash = hashFontData(m_fileContents.get(), m_fileSize);
+            m_fontHashCalculated = true;
+        }
 
-        // Update the row informations
-        bestRow->width += width;
-        return rect;
+        return m_fontHash;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -43,6 +43,7 @@ namespace tgui
 
     bool BackendFontRaylib::loadFromMemory(std::unique_ptr<std::uint8_t[]> data, std::size_t sizeInBytes)
     {
+        clearMeasurementCache();
         m_cachedAscents.clear();
         m_glyphs.clear();
         m_nextRow = 3; // First 2 rows contain pixels for underlining
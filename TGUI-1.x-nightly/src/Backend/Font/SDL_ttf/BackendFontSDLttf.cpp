@@ -49,6 +49,7 @@ namespace tgui
 
     bool BackendFontSDLttf::loadFromMemory(std::unique_ptr<std::uint8_t[]> data, std::size_t sizeInBytes)
     {
+        clearMeasurementCache();
         m_glyphs.clear();
         m_rows.clear();
         m_pixels = nullptr;
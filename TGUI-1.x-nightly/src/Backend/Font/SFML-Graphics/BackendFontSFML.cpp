@@ -41,6 +41,7 @@ namespace tgui
 
     bool BackendFontSFML::loadFromMemory(std::unique_ptr<std::uint8_t[]> data, std::size_t sizeInBytes)
     {
+        clearMeasurementCache();
         m_textures.clear();
         m_textureVersions.clear();
 
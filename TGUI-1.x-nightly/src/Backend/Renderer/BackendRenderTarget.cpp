@@ -28,6 +28,7 @@
 
 #include <cassert>
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
     #include <array>
     #include <cmath>
 
@@ -42,90 +43,75 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    TGUI_NODISCARD static std::vector<Vector2f> drawCircleHelperGetPoints(unsigned int nrPoints, float radius, float offset)
-    {
-#if defined(__cpp_lib_math_constants) && (__cpp_lib_math_constants >= 201907L)
-        const float twoPi = 2.f * std::numbers::pi_v<float>;
-#else
-        const float twoPi = 2.f * 3.14159265359f;
-#endif
-        std::vector<Vector2f> points;
-        points.reserve(nrPoints);
-
-        for (unsigned int i = 0; i < nrPoints; ++i)
-        {
-            points.emplace_back(offset + radius + (radius * std::cos(twoPi * i / nrPoints)),
-                                offset + radius + (radius * std::sin(twoPi * i / nrPoints)));
-        }
-
-        return points;
-    }
+    // Point counts depend on the size of the shapes, so the amount of cached circles is limited in case sizes keep changing
+    static constexpr std::size_t MaxCachedUnitCircles = 64;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    TGUI_NODISCARD static std::vector<Vector2f> drawRoundedRectHelperGetPoints(unsigned int nrCornerPoints, const Vector2f& size, float radius, float offset)
+    // Returns the alpha value in the font texture at which the edge of the glyphs lies, or 0 if the font doesn't use distance fields.
+    // An outline is drawn by moving the edge outwards, which is limited by how far the distance field extends around the glyphs.
+    TGUI_NODISCARD static float getDistanceFieldEdge(const BackendText& text, float outlineThickness)
     {
-        assert(nrCornerPoints != 0);
+        const auto& font = text.getFont();
+        const float spread = font ? font->getDistanceFieldSpread(text.getCharacterSize()) : 0;
+        if (spread <= 0)
+            return 0;
 
-#if defined(__cpp_lib_math_constants) && (__cpp_lib_math_constants >= 201907L)
-        const float twoPi = 2.f * std::numbers::pi_v<float>;
-#else
-        const float twoPi = 2.f * 3.14159265359f;
-#endif
-        std::vector<Vector2f> points;
-        points.reserve(nrCornerPoints * 4);
+        return std::max(1 / 255.f, std::min(0.5f - (0.5f * outlineThickness / spread), 254 / 255.f));
+    }
 
-        const unsigned int nrPointsInCircle = 4 * (nrCornerPoints - 1);
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        // Top right corner
-        for (unsigned int i = 0; i < nrCornerPoints; ++i)
-        {
-            points.emplace_back(offset + size.x - radius + (radius * std::cos(twoPi * i / nrPointsInCircle)),
-                                offset + radius - (radius * std::sin(twoPi * i / nrPointsInCircle)));
-        }
+    static void drawCircleHelperGetPoints(std::vector<Vector2f>& points, const std::vector<Vector2f>& unitCircle, float radius, float offset)
+    {
+        points.clear();
+        for (const Vector2f& unitPoint : unitCircle)
+            points.emplace_back(offset + radius + (radius * unitPoint.x), offset + radius + (radius * unitPoint.y));
+    }
 
-        // Top left corner
-        for (unsigned int i = 0; i < nrCornerPoints; ++i)
-        {
-            points.emplace_back(offset + radius + (radius * std::cos(twoPi * ((nrCornerPoints - 1) + i) / nrPointsInCircle)),
-                                offset + radius - (radius * std::sin(twoPi * ((nrCornerPoints - 1) + i) / nrPointsInCircle)));
-        }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        // Bottom left corner
-        for (unsigned int i = 0; i < nrCornerPoints; ++i)
-        {
-            points.emplace_back(offset + radius + (radius * std::cos(twoPi * (2*(nrCornerPoints - 1) + i) / nrPointsInCircle)),
-                                offset + size.y - radius - (radius * std::sin(twoPi * (2*(nrCornerPoints - 1) + i) / nrPointsInCircle)));
-        }
+    static void drawRoundedRectHelperGetPoints(std::vector<Vector2f>& points, const std::vector<Vector2f>& unitCircle,
+                                               unsigned int nrCornerPoints, const Vector2f& size, float radius, float offset)
+    {
+        assert(nrCornerPoints != 0);
 
-        // Bottom right corner
-        for (unsigned int i = 0; i < nrCornerPoints; ++i)
+        // The unit circle contains 4 * (nrCornerPoints - 1) points, the last point of each corner is the first point of the next corner.
+        // The y coordinate is inverted because the corners go clockwise on the screen while the unit circle is counter-clockwise.
+        points.clear();
+        const std::size_t nrPointsInCircle = unitCircle.size();
+        const std::array<Vector2f, 4> centers = {{
+            {offset + size.x - radius, offset + radius},          // Top right corner
+            {offset + radius, offset + radius},                   // Top left corner
+            {offset + radius, offset + size.y - radius},          // Bottom left corner
+            {offset + size.x - radius, offset + size.y - radius}  // Bottom right corner
+        }};
+        for (std::size_t corner = 0; corner < centers.size(); ++corner)
         {
-            points.emplace_back(offset + size.x - radius + (radius * std::cos(twoPi * (3*(nrCornerPoints - 1) + i) / nrPointsInCircle)),
-                                offset + size.y - radius - (radius * std::sin(twoPi * (3*(nrCornerPoints - 1) + i) / nrPointsInCircle)));
+            for (std::size_t i = 0; i < nrCornerPoints; ++i)
+            {
+                const Vector2f& unitPoint = unitCircle[(corner * (nrCornerPoints - 1) + i) % nrPointsInCircle];
+                points.emplace_back(centers[corner].x + (radius * unitPoint.x), centers[corner].y - (radius * unitPoint.y));
+            }
         }
-
-        return points;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    static void drawBordersAroundShape(BackendRenderTarget* renderTarget, const RenderStates& states,
+    static void drawBordersAroundShape(BackendRenderTarget* renderTarget, const RenderStates& states, std::vector<Vertex>& vertices, std::vector<unsigned int>& indices,
                                        const std::vector<Vector2f>& outerPoints, const std::vector<Vector2f>& innerPoints, const Color& color)
     {
         TGUI_ASSERT(outerPoints.size() == innerPoints.size(), "Inner and outer ring of cicle border should have the same amount of points");
 
         // Create the vertices
-        std::vector<Vertex> vertices;
-        vertices.reserve(outerPoints.size() + innerPoints.size());
+        vertices.clear();
         for (const auto& point : outerPoints)
             vertices.emplace_back(point, Vertex::Color(color));
         for (const auto& point : innerPoints)
             vertices.emplace_back(point, Vertex::Color(color));
 
         // Create the indices
-        std::vector<unsigned int> indices;
-        indices.reserve(3 * (outerPoints.size() + innerPoints.size()));
+        indices.clear();
         for (std::size_t i = 0; i < outerPoints.size(); ++i)
         {
             indices.push_back(static_cast<unsigned int>(i));
@@ -148,18 +134,17 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    static void drawInnerShape(BackendRenderTarget* renderTarget, const RenderStates& states, const std::vector<Vector2f>& points, const Vector2f& centerPoint, const Color& color)
+    static void drawInnerShape(BackendRenderTarget* renderTarget, const RenderStates& states, std::vector<Vertex>& vertices, std::vector<unsigned int>& indices,
+                               const std::vector<Vector2f>& points, const Vector2f& centerPoint, const Color& color)
     {
         // Create the vertices (one point in the middle of the circle and the others as provided in the 'points' parameter)
-        std::vector<Vertex> vertices;
-        vertices.reserve(1 + points.size());
+        vertices.clear();
         vertices.emplace_back(centerPoint, Vertex::Color(color));
         for (const auto& point : points)
             vertices.emplace_back(point, Vertex::Color(color));
 
         // Create the indices
-        std::vector<unsigned int> indices;
-        indices.reserve(3 * points.size());
+        indices.clear();
         for (std::size_t i = 1; i <= points.size(); ++i)
         {
             indices.push_back(0); // Center point
@@ -356,20 +341,9 @@ namespace tgui
 
     void BackendRenderTarget::drawText(const RenderStates& states, const Text& text)
     {
-        RenderStates transformedStates = states;
-        transformedStates.transform.translate(text.getPosition());
-
-        // Round the text to the nearest pixel to try to avoid blurry text
-        transformedStates.transform.roundPosition(m_pixelsPerPoint);
-
-        auto vertexData = text.getBackendText()->getVertexData();
-
-        for (const auto& data : vertexData)
-        {
-            const std::shared_ptr<BackendTexture>& texture = data.first;
-            const std::shared_ptr<std::vector<Vertex>>& vertices = data.second;
-            drawVertexArray(transformedStates, vertices->data(), vertices->size(), nullptr, 0, texture);
-        }
+        // The outline and the text are drawn separately, because they use a different edge when the font has distance fields
+        drawTextOutline(states, text);
+        drawTextWithoutOutline(states, text);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -382,14 +356,14 @@ namespace tgui
         // Round the text to the nearest pixel to try to avoid blurry text
         transformedStates.transform.roundPosition(m_pixelsPerPoint);
 
-        auto vertexData = text.getBackendText()->getVertexData(true, false);
+        const auto& backendText = text.getBackendText();
+        auto vertexData = backendText->getVertexData(true, false);
+        if (vertexData.empty())
+            return;
 
+        const float distanceFieldEdge = getDistanceFieldEdge(*backendText, backendText->getOutlineThickness());
         for (const auto& data : vertexData)
-        {
-            const std::shared_ptr<BackendTexture>& texture = data.first;
-            const std::shared_ptr<std::vector<Vertex>>& vertices = data.second;
-            drawVertexArray(transformedStates, vertices->data(), vertices->size(), nullptr, 0, texture);
-        }
+            drawTextVertices(transformedStates, *data.second, data.first, distanceFieldEdge);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -402,14 +376,14 @@ namespace tgui
         // Round the text to the nearest pixel to try to avoid blurry text
         transformedStates.transform.roundPosition(m_pixelsPerPoint);
 
-        auto vertexData = text.getBackendText()->getVertexData(false, true);
+        const auto& backendText = text.getBackendText();
+        auto vertexData = backendText->getVertexData(false, true);
+        if (vertexData.empty())
+            return;
 
+        const float distanceFieldEdge = getDistanceFieldEdge(*backendText, 0);
         for (const auto& data : vertexData)
-        {
-            const std::shared_ptr<BackendTexture>& texture = data.first;
-            const std::shared_ptr<std::vector<Vertex>>& vertices = data.second;
-            drawVertexArray(transformedStates, vertices->data(), vertices->size(), nullptr, 0, texture);
-        }
+            drawTextVertices(transformedStates, *data.second, data.first, distanceFieldEdge);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -426,26 +400,30 @@ namespace tgui
     {
         const float radius = size / 2.f;
         const unsigned int nrPoints = static_cast<unsigned int>(std::ceil((radius + std::abs(borderThickness)) * 4));
+        if (nrPoints == 0)
+            return;
+
+        const std::vector<Vector2f>& unitCircle = getUnitCirclePoints(nrPoints);
         if (borderThickness > 0)
         {
-            const std::vector<Vector2f>& outerPoints = drawCircleHelperGetPoints(nrPoints, radius + borderThickness, -borderThickness);
-            const std::vector<Vector2f>& innerPoints = drawCircleHelperGetPoints(nrPoints, radius, 0);
+            drawCircleHelperGetPoints(m_outerShapePoints, unitCircle, radius + borderThickness, -borderThickness);
+            drawCircleHelperGetPoints(m_innerShapePoints, unitCircle, radius, 0);
 
-            drawBordersAroundShape(this, states, outerPoints, innerPoints, borderColor);
-            drawInnerShape(this, states, innerPoints, {radius, radius}, backgroundColor);
+            drawBordersAroundShape(this, states, m_shapeVertices, m_shapeIndices, m_outerShapePoints, m_innerShapePoints, borderColor);
+            drawInnerShape(this, states, m_shapeVertices, m_shapeIndices, m_innerShapePoints, {radius, radius}, backgroundColor);
         }
         else if (borderThickness < 0)
         {
-            const std::vector<Vector2f>& outerPoints = drawCircleHelperGetPoints(nrPoints, radius, 0);
-            const std::vector<Vector2f>& innerPoints = drawCircleHelperGetPoints(nrPoints, radius + borderThickness, -borderThickness);
+            drawCircleHelperGetPoints(m_outerShapePoints, unitCircle, radius, 0);
+            drawCircleHelperGetPoints(m_innerShapePoints, unitCircle, radius + borderThickness, -borderThickness);
 
-            drawBordersAroundShape(this, states, outerPoints, innerPoints, borderColor);
-            drawInnerShape(this, states, innerPoints, {radius, radius}, backgroundColor);
+            drawBordersAroundShape(this, states, m_shapeVertices, m_shapeIndices, m_outerShapePoints, m_innerShapePoints, borderColor);
+            drawInnerShape(this, states, m_shapeVertices, m_shapeIndices, m_innerShapePoints, {radius, radius}, backgroundColor);
         }
         else // No outline
         {
-            const std::vector<Vector2f>& innerPoints = drawCircleHelperGetPoints(nrPoints, radius, 0);
-            drawInnerShape(this, states, innerPoints, {radius, radius}, backgroundColor);
+            drawCircleHelperGetPoints(m_innerShapePoints, unitCircle, radius, 0);
+            drawInnerShape(this, states, m_shapeVertices, m_shapeIndices, m_innerShapePoints, {radius, radius}, backgroundColor);
         }
     }
 
@@ -460,8 +438,10 @@ namespace tgui
         if (radius > size.y / 2)
             radius = size.y / 2;
 
+        // With a single point per corner, all corners use the point at angle 0 (which lies on the corner itself since the radius is 0)
         const unsigned int nrCornerPoints = std::max(1u, static_cast<unsigned int>(std::ceil(radius * 2)));
-        const std::vector<Vector2f>& outerPoints = drawRoundedRectHelperGetPoints(nrCornerPoints, size, radius, 0);
+        const std::vector<Vector2f>& unitCircle = getUnitCirclePoints(std::max(1u, 4 * (nrCornerPoints - 1)));
+        drawRoundedRectHelperGetPoints(m_outerShapePoints, unitCircle, nrCornerPoints, size, radius, 0);
 
         const float borderWidth = borders.getLeft();
         if (borderWidth > 0)
@@ -473,13 +453,37 @@ namespace tgui
             if (radius > innerSize.y / 2)
                 radius = innerSize.y / 2;
 
-            const std::vector<Vector2f>& innerPoints = drawRoundedRectHelperGetPoints(nrCornerPoints, innerSize, radius, borderWidth);
+            drawRoundedRectHelperGetPoints(m_innerShapePoints, unitCircle, nrCornerPoints, innerSize, radius, borderWidth);
 
-            drawBordersAroundShape(this, states, outerPoints, innerPoints, borderColor);
-            drawInnerShape(this, states, innerPoints, size/2.f, backgroundColor);
+            drawBordersAroundShape(this, states, m_shapeVertices, m_shapeIndices, m_outerShapePoints, m_innerShapePoints, borderColor);
+            drawInnerShape(this, states, m_shapeVertices, m_shapeIndices, m_innerShapePoints, size/2.f, backgroundColor);
         }
         else // There are no borders
-            drawInnerShape(this, states, outerPoints, size/2.f, backgroundColor);
+            drawInnerShape(this, states, m_shapeVertices, m_shapeIndices, m_outerShapePoints, size/2.f, backgroundColor);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::vector<Vector2f>& BackendRenderTarget::getUnitCirclePoints(unsigned int nrPoints)
+    {
+        const auto it = m_unitCirclePoints.find(nrPoints);
+        if (it != m_unitCirclePoints.end())
+            return it->second;
+
+        if (m_unitCirclePoints.size() >= MaxCachedUnitCircles)
+            m_unitCirclePoints.clear();
+
+#if defined(__cpp_lib_math_constants) && (__cpp_lib_math_constants >= 201907L)
+        const float twoPi = 2.f * std::numbers::pi_v<float>;
+#else
+        const float twoPi = 2.f * 3.14159265359f;
+#endif
+        std::vector<Vector2f>& points = m_unitCirclePoints[nrPoints];
+        points.reserve(nrPoints);
+        for (unsigned int i = 0; i < nrPoints; ++i)
+            points.emplace_back(std::cos(twoPi * i / nrPoints), std::sin(twoPi * i / nrPoints));
+
+        return points;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -490,6 +494,14 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTarget::drawTextVertices(const RenderStates& states, const std::vector<Vertex>& vertices,
+                                               const std::shared_ptr<BackendTexture>& texture, float)
+    {
+        drawVertexArray(states, vertices.data(), vertices.size(), nullptr, 0, texture);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
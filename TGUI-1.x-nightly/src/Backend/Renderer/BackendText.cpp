@@ -199,7 +199,7 @@ namespace tgui
             index = m_string.length();
 
         const bool isBold           = static_cast<unsigned int>(m_style) & TextStyle::Bold;
-        const float whitespaceWidth = m_font->getGlyph(U' ', m_characterSize, isBold).advance;
+        const float whitespaceWidth = m_font->getGlyphAdvance(U' ', m_characterSize, isBold);
         const float lineSpacing     = m_font->getLineSpacing(m_characterSize);
 
         Vector2f position;
@@ -213,7 +213,7 @@ namespace tgui
                 continue;
 
             // Apply the kerning offset
-            position.x += m_font->getKerning(prevChar, curChar, m_characterSize, isBold);
+            position.x += m_font->getCachedKerning(prevChar, curChar, m_characterSize, isBold);
             prevChar = curChar;
 
             // Handle special characters
@@ -225,7 +225,7 @@ namespace tgui
             }
 
             // For regular characters, add the advance offset of the glyph
-            position.x += m_font->getGlyph(curChar, m_characterSize, isBold).advance;
+            position.x += m_font->getGlyphAdvance(curChar, m_characterSize, isBold);
         }
 
         return position;
@@ -253,8 +253,25 @@ namespace tgui
         {
             updateVertices();
 
-            // It is possible that the texture changes during the update
-            texture = m_font->getTexture(m_characterSize, m_lastFontTextureVersion);
+            // It is possible that the texture changes during the update, e.g. when the glyph atlas had to grow or was reset
+            // while loading new glyphs. The glyphs that were placed before the change then have to be looked up again.
+            // This is only retried once, a text that doesn't fit in the atlas would otherwise keep resetting it.
+            unsigned int newTextureVersion;
+            texture = m_font->getTexture(m_characterSize, newTextureVersion);
+            if (newTextureVersion != textureVersion)
+            {
+                textureVersion = newTextureVersion;
+                m_verticesNeedUpdate = true;
+                updateVertices();
+                texture = m_font->getTexture(m_characterSize, newTextureVersion);
+
+                // If the texture changed again then the vertices weren't built against it. Storing the version from before
+                // the retry makes sure that the vertices are updated again the next time they are requested.
+                if (newTextureVersion != textureVersion)
+                    m_verticesNeedUpdate = true;
+            }
+
+            m_lastFontTextureVersion = textureVersion;
         }
 
         if (includeOutline && m_outlineVertices && !m_outlineVertices->empty())
@@ -299,6 +316,12 @@ namespace tgui
         const float underlineThickness = m_font->getUnderlineThickness(m_characterSize);
         const float fontScale          = m_font->getFontScale();
 
+        // Distance field glyphs already contain the spread of the field around them, so they don't need extra padding.
+        // Their outline is drawn by the shader, the outline glyph is the same as the normal glyph.
+        const float distanceFieldSpread = m_font->getDistanceFieldSpread(m_characterSize);
+        const float glyphPadding = (distanceFieldSpread > 0) ? 0 : 1 / fontScale;
+        const float glyphTexturePadding = (distanceFieldSpread > 0) ? 0 : 1;
+
         // Compute the location of the strike through dynamically
         // We use the center point of the lowercase 'x' glyph as the reference
         // We reuse the underline thickness as the thickness of the strike through as well
@@ -306,7 +329,7 @@ namespace tgui
         const float strikeThroughOffset = isStrikeThrough ? (xBounds.top + (xBounds.height / 2.f)) : 0.f;
 
         // Precompute the variables needed by the algorithm
-        const float whitespaceWidth = m_font->getGlyph(U' ', m_characterSize, isBold).advance;
+        const float whitespaceWidth = m_font->getGlyphAdvance(U' ', m_characterSize, isBold);
         const float lineSpacing = m_font->getLineSpacing(m_characterSize);
         float x = m_outlineThickness;
         float y = m_font->getAscent(m_characterSize) + m_outlineThickness;
@@ -322,7 +345,7 @@ namespace tgui
                 continue;
 
             // Apply the kerning offset
-            x += m_font->getKerning(prevChar, curChar, m_characterSize, isBold);
+            x += m_font->getCachedKerning(prevChar, curChar, m_characterSize, isBold);
 
             // If we're using the underlined style and there's a new line, draw a line
             if (isUnderlined && (curChar == U'\n' && prevChar != U'\n'))
@@ -371,9 +394,14 @@ namespace tgui
 
                 float top    = glyph.bounds.top;
                 float right  = glyph.bounds.left + glyph.bounds.width;
+                if (distanceFieldSpread > 0)
+                {
+                    top += distanceFieldSpread - m_outlineThickness;
+                    right -= distanceFieldSpread - m_outlineThickness;
+                }
 
                 // Add the outline glyph to the vertices
-                addGlyphQuad(*m_outlineVertices, {x, y}, vertexOutlineColor, glyph, fontScale, italicShear);
+                addGlyphQuad(*m_outlineVertices, {x, y}, vertexOutlineColor, glyph, glyphPadding, glyphTexturePadding, italicShear);
                 maxX = std::max(maxX, x + right - italicShear * top - m_outlineThickness);
             }
 
@@ -381,11 +409,14 @@ namespace tgui
             const auto& glyph = m_font->getGlyph(curChar, m_characterSize, isBold);
 
             // Add the glyph to the vertices
-            addGlyphQuad(*m_vertices, {x, y}, vertexFillColor, glyph, fontScale, italicShear);
+            addGlyphQuad(*m_vertices, {x, y}, vertexFillColor, glyph, glyphPadding, glyphTexturePadding, italicShear);
 
             // Update the current bounds with the non outlined glyph bounds
             if (m_outlineThickness == 0)
-                maxX = std::max(maxX, x + glyph.bounds.left + glyph.bounds.width - italicShear * glyph.bounds.top);
+            {
+                maxX = std::max(maxX, x + glyph.bounds.left + glyph.bounds.width - distanceFieldSpread
+                                      - italicShear * (glyph.bounds.top + distanceFieldSpread));
+            }
 
             // Advance to the next character
             x += glyph.advance;
@@ -443,19 +474,18 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void BackendText::addGlyphQuad(std::vector<Vertex>& vertices, Vector2f position, const Vertex::Color& color, const FontGlyph& glyph, float fontScale, float italicShear)
+    void BackendText::addGlyphQuad(std::vector<Vertex>& vertices, Vector2f position, const Vertex::Color& color, const FontGlyph& glyph,
+                                   float padding, float texturePadding, float italicShear)
     {
-        const float padding = 1;
-
-        const float left   = glyph.bounds.left - padding / fontScale;
-        const float top    = glyph.bounds.top - padding / fontScale;
-        const float right  = glyph.bounds.left + glyph.bounds.width + padding / fontScale;
-        const float bottom = glyph.bounds.top  + glyph.bounds.height + padding / fontScale;
-
-        const float u1 = glyph.textureRect.left - padding;
-        const float v1 = glyph.textureRect.top - padding;
-        const float u2 = glyph.textureRect.left + glyph.textureRect.width + padding;
-        const float v2 = glyph.textureRect.top  + glyph.textureRect.height + padding;
+        const float left   = glyph.bounds.left - padding;
+        const float top    = glyph.bounds.top - padding;
+        const float right  = glyph.bounds.left + glyph.bounds.width + padding;
+        const float bottom = glyph.bounds.top  + glyph.bounds.height + padding;
+
+        const float u1 = glyph.textureRect.left - texturePadding;
+        const float v1 = glyph.textureRect.top - texturePadding;
+        const float u2 = glyph.textureRect.left + glyph.textureRect.width + texturePadding;
+        const float v2 = glyph.textureRect.top  + glyph.textureRect.height + texturePadding;
 
         vertices.emplace_back(Vector2f{position.x + left  - italicShear * top   , position.y + top   }, color, Vector2f{u1, v1});
         vertices.emplace_back(Vector2f{position.x + right - italicShear * top   , position.y + top   }, color, Vector2f{u2, v1});
@@ -33,6 +33,7 @@
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <numeric>
+    #include <cstring>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -218,9 +219,7 @@ namespace tgui
 
     BackendRenderTargetGLES2::~BackendRenderTargetGLES2()
     {
-        TGUI_GL_CHECK(glDeleteBuffers(1, &m_vertexBuffer));
-        TGUI_GL_CHECK(glDeleteBuffers(1, &m_indexBuffer));
-
+        // The vertex and index buffers are deleted by their own destructors
         if (TGUI_GLAD_GL_ES_VERSION_3_0)
             TGUI_GL_CHECK(glDeleteVertexArrays(1, &m_vertexArray));
     }
@@ -302,8 +301,8 @@ namespace tgui
         TGUI_GL_CHECK(glUseProgram(m_shaderProgram));
         if (TGUI_GLAD_GL_ES_VERSION_3_0)
             TGUI_GL_CHECK(glBindVertexArray(m_vertexArray));
-        TGUI_GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer));
-        TGUI_GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indexBuffer));
+        TGUI_GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer.getBuffer()));
+        TGUI_GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indexBuffer.getBuffer()));
 
         // Don't make any assumptions about the currently set texture
         m_currentTexture = nullptr;
@@ -363,23 +362,52 @@ namespace tgui
             }
         }
 
-        // Load the data into the vertex buffer. After some experimenting, orphaning the buffer and allocating a new one each time
-        // was (suprisingly) faster than creating a larger buffer and only writing to non-overlapping ranges within a frame.
-        // Batch rendering (and re-arranging draw calls to be better batchable) would be much faster though.
-        TGUI_GL_CHECK(glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(vertexCount * sizeof(Vertex)), vertices, GL_DYNAMIC_DRAW));
+        // Write the vertices behind what was already written to the ring buffer, so that the driver never has to reallocate it.
+        // On OpenGL ES 2.0 the buffer is still orphaned on every draw, as there is no way to write to part of it.
+        std::size_t firstVertex = 0;
+        void* vertexData = m_vertexBuffer.map(vertexCount, firstVertex);
+        std::memcpy(vertexData, vertices, vertexCount * sizeof(Vertex));
+        m_vertexBuffer.unmap();
+
+        if (m_vertexBuffer.wasRecreated())
+            setVertexAttribs();
 
         const Transform finalTransform = m_projectionTransform * states.transform;
         glUniformMatrix4fv(m_projectionMatrixShaderUniformLocation, 1, GL_FALSE, finalTransform.getMatrix().data());
 
         if (indices)
         {
-            // Load the data into the index buffer
-            TGUI_GL_CHECK(glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(indexCount * sizeof(GLuint)), indices, GL_STREAM_DRAW));
-
-            TGUI_GL_CHECK(glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(indexCount), GL_UNSIGNED_INT, nullptr));
+            // Load the data into the index buffer. The indices have to be moved to where the vertices ended up in the buffer.
+            std::size_t firstIndex = 0;
+            auto* indexData = static_cast<GLuint*>(m_indexBuffer.map(indexCount, firstIndex));
+            const auto baseIndex = static_cast<GLuint>(firstVertex);
+            for (std::size_t i = 0; i < indexCount; ++i)
+                indexData[i] = baseIndex + indices[i];
+            m_indexBuffer.unmap();
+
+            // On OpenGL ES 3.0 the index buffer binding is part of the vertex array object, which still refers to the old buffer
+            if (m_indexBuffer.wasRecreated())
+                TGUI_GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indexBuffer.getBuffer()));
+
+            TGUI_GL_CHECK(glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(indexCount), GL_UNSIGNED_INT,
+                                         reinterpret_cast<const GLvoid*>(firstIndex * sizeof(GLuint))));
+            m_indexBuffer.fence();
         }
         else // No indices were given, all vertices need to be drawn in the order they were provided
-            TGUI_GL_CHECK(glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(vertexCount)));
+            TGUI_GL_CHECK(glDrawArrays(GL_TRIANGLES, static_cast<GLint>(firstVertex), static_cast<GLsizei>(vertexCount)));
+
+        // The ring buffer may only reuse the written sections once the GPU has executed this draw call
+        m_vertexBuffer.fence();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    StreamBufferStatistics BackendRenderTargetGLES2::getStreamBufferStatistics() const
+    {
+        StreamBufferStatistics statistics;
+        m_vertexBuffer.addStatistics(statistics);
+        m_indexBuffer.addStatistics(statistics);
+        return statistics;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -428,15 +456,18 @@ namespace tgui
             TGUI_GL_CHECK(glBindVertexArray(m_vertexArray));
         }
 
-        // Create the vertex buffer
-        TGUI_GL_CHECK(glGenBuffers(1, &m_vertexBuffer));
-        TGUI_GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer));
+        // OpenGL ES 3.0 can map the part of the buffer that is written, OpenGL ES 2.0 has to replace the whole buffer each time
+        const StreamBufferOpenGL::Mode mode = TGUI_GLAD_GL_ES_VERSION_3_0 ? StreamBufferOpenGL::Mode::MapUnsynchronized : StreamBufferOpenGL::Mode::Orphan;
 
         // Create the index buffer
-        TGUI_GL_CHECK(glGenBuffers(1, &m_indexBuffer));
-        TGUI_GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indexBuffer));
+        m_indexBuffer.create(GL_ELEMENT_ARRAY_BUFFER, sizeof(GLuint), 4 * 24576, mode);
+
+        // Create the vertex buffer. It is created last so that it is still bound when setting the vertex attributes.
+        m_vertexBuffer.create(GL_ARRAY_BUFFER, sizeof(Vertex), 4 * 16384, mode);
 
         setVertexAttribs();
+        (void)m_vertexBuffer.wasRecreated();
+        (void)m_indexBuffer.wasRecreated();
 
         if (TGUI_GLAD_GL_ES_VERSION_3_0)
             TGUI_GL_CHECK(glBindVertexArray(0));
@@ -32,7 +32,10 @@
 #endif
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
     #include <numeric>
+    #include <cstring>
+    #include <cmath>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -41,7 +44,85 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    TGUI_NODISCARD static GLuint createShaderProgram()
+    // Fragment shader that is shared by the triangles and the quads
+    static const GLchar* const TextureFragmentShaderSource =
+    {
+        "#version 330 core\n"
+        "uniform sampler2D uTexture;\n"
+        "in vec4 color;\n"
+        "in vec2 texCoord;\n"
+        "out vec4 outColor;\n"
+        "void main() {\n"
+        "    outColor = texture(uTexture, texCoord) * color;\n"
+        "}"
+    };
+
+    // Fragment shader for text of which the font texture contains signed distance fields. The distance is used to find out how
+    // much of the pixel is covered by the glyph, independent of how much the glyph is scaled. Outlines use an edge further outwards.
+    static const GLchar* const DistanceFieldFragmentShaderSource =
+    {
+        "#version 330 core\n"
+        "uniform sampler2D uTexture;\n"
+        "uniform float distanceFieldEdge;\n"
+        "in vec4 color;\n"
+        "in vec2 texCoord;\n"
+        "out vec4 outColor;\n"
+        "void main() {\n"
+        "    float fieldValue = texture(uTexture, texCoord).a;\n"
+        "    float smoothing = max(fwidth(fieldValue) * 0.75, 0.001);\n"
+        "    float alpha = smoothstep(distanceFieldEdge - smoothing, distanceFieldEdge + smoothing, fieldValue);\n"
+        "    outColor = vec4(color.rgb, color.a * alpha);\n"
+        "}"
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TGUI_NODISCARD static GLuint createShaderProgram(const GLchar* vertexShaderSource, const GLchar* fragmentShaderSource)
+    {
+
+        // Create the vertex shader
+        GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
+        if (vertexShader == 0)
+            throw Exception{U"Failed to create shaders in BackendRenderTargetOpenGL3. glCreateShader(GL_VERTEX_SHADER) returned 0."};
+
+        TGUI_GL_CHECK(glShaderSource(vertexShader, 1, &vertexShaderSource, nullptr));
+        TGUI_GL_CHECK(glCompileShader(vertexShader));
+
+        GLint vertexShaderCompiled = GL_FALSE;
+        TGUI_GL_CHECK(glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &vertexShaderCompiled));
+        if (vertexShaderCompiled != GL_TRUE)
+            throw Exception{U"Failed to create shaders in BackendRenderTargetOpenGL3. Failed to compile vertex shader."};
+
+        // Create the fragment shader
+        GLuint fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+        if (fragmentShader == 0)
+            throw Exception{U"Failed to create shaders in BackendRenderTargetOpenGL3. glCreateShader(GL_FRAGMENT_SHADER) returned 0."};
+
+        TGUI_GL_CHECK(glShaderSource(fragmentShader, 1, &fragmentShaderSource, nullptr));
+        TGUI_GL_CHECK(glCompileShader(fragmentShader));
+
+        GLint fragmentShaderCompiled = GL_FALSE;
+        TGUI_GL_CHECK(glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &fragmentShaderCompiled));
+        if (fragmentShaderCompiled != GL_TRUE)
+            throw Exception{U"Failed to create shaders in BackendRenderTargetOpenGL3. Failed to compile fragment shader."};
+
+        // Link the vertex and fragment shader into a program
+        GLuint programId = glCreateProgram();
+        TGUI_GL_CHECK(glAttachShader(programId, vertexShader));
+        TGUI_GL_CHECK(glAttachShader(programId, fragmentShader));
+        TGUI_GL_CHECK(glLinkProgram(programId));
+
+        GLint programLinked = GL_TRUE;
+        TGUI_GL_CHECK(glGetProgramiv(programId, GL_LINK_STATUS, &programLinked));
+        if (programLinked != GL_TRUE)
+            throw Exception{U"Failed to create shaders in BackendRenderTargetOpenGL3. Failed to link the shaders."};
+
+        return programId;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TGUI_NODISCARD static GLuint createTriangleShaderProgram(const GLchar* fragmentShaderSource)
     {
         const GLchar* vertexShaderSource;
         if (TGUI_GLAD_GL_VERSION_4_3)
@@ -77,69 +158,161 @@ namespace tgui
                 "}";
         }
 
+        return createShaderProgram(vertexShaderSource, fragmentShaderSource);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TGUI_NODISCARD static GLuint createQuadShaderProgram(const GLchar* fragmentShaderSource)
+    {
+        // Every quad is a single instance that is drawn as a triangle strip of 4 vertices.
+        // The vertex id is used to find the corner of the quad that is being drawn.
+        const GLchar* vertexShaderSource;
+        if (TGUI_GLAD_GL_VERSION_4_3)
+        {
+            vertexShaderSource =
+                "#version 430 core\n"
+                "layout(location=0) uniform mat4 projectionMatrix;\n"
+                "layout(location=0) in vec4 inRect;\n"
+                "layout(location=1) in vec4 inTexRect;\n"
+                "layout(location=2) in vec4 inColor;\n"
+                "out vec4 color;\n"
+                "out vec2 texCoord;\n"
+                "void main() {\n"
+                "    vec2 corner = vec2(float(gl_VertexID & 1), float(gl_VertexID >> 1));\n"
+                "    gl_Position = projectionMatrix * vec4(inRect.xy + corner * inRect.zw, 0, 1);\n"
+                "    color = inColor;\n"
+                "    texCoord = inTexRect.xy + corner * inTexRect.zw;\n"
+                "}";
+        }
+        else // No OpenGL 4.3 support
+        {
+            vertexShaderSource =
+                "#version 330 core\n"
+                "uniform mat4 projectionMatrix;\n"
+                "layout(location=0) in vec4 inRect;\n"
+                "layout(location=1) in vec4 inTexRect;\n"
+                "layout(location=2) in vec4 inColor;\n"
+                "out vec4 color;\n"
+                "out vec2 texCoord;\n"
+                "void main() {\n"
+                "    vec2 corner = vec2(float(gl_VertexID & 1), float(gl_VertexID >> 1));\n"
+                "    gl_Position = projectionMatrix * vec4(inRect.xy + corner * inRect.zw, 0, 1);\n"
+                "    color = inColor;\n"
+                "    texCoord = inTexRect.xy + corner * inTexRect.zw;\n"
+                "}";
+        }
+
+        return createShaderProgram(vertexShaderSource, fragmentShaderSource);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TGUI_NODISCARD static GLuint createShapeShaderProgram()
+    {
+        // Every shape is a single instance that is drawn as a triangle strip of 4 vertices, like the quads.
+        // The quad is made 1 unit larger on each side to leave room for the anti-aliased edge.
+        const GLchar* vertexShaderSource;
+        if (TGUI_GLAD_GL_VERSION_4_3)
+        {
+            vertexShaderSource =
+                "#version 430 core\n"
+                "layout(location=0) uniform mat4 projectionMatrix;\n"
+                "layout(location=0) in vec4 inRect;\n"
+                "layout(location=1) in vec4 inBackgroundColor;\n"
+                "layout(location=2) in vec4 inBorderColor;\n"
+                "layout(location=3) in vec2 inShape;\n"
+                "out vec2 localPos;\n"
+                "flat out vec2 halfSize;\n"
+                "flat out vec2 shape;\n"
+                "flat out vec4 backgroundColor;\n"
+                "flat out vec4 borderColor;\n"
+                "void main() {\n"
+                "    vec2 corner = vec2(float(gl_VertexID & 1), float(gl_VertexID >> 1));\n"
+                "    vec2 position = inRect.xy - vec2(1.0) + corner * (inRect.zw + vec2(2.0));\n"
+                "    gl_Position = projectionMatrix * vec4(position, 0, 1);\n"
+                "    halfSize = inRect.zw * 0.5;\n"
+                "    localPos = position - inRect.xy - halfSize;\n"
+                "    shape = inShape;\n"
+                "    backgroundColor = inBackgroundColor;\n"
+                "    borderColor = inBorderColor;\n"
+                "}";
+        }
+        else // No OpenGL 4.3 support
+        {
+            vertexShaderSource =
+                "#version 330 core\n"
+                "uniform mat4 projectionMatrix;\n"
+                "layout(location=0) in vec4 inRect;\n"
+                "layout(location=1) in vec4 inBackgroundColor;\n"
+                "layout(location=2) in vec4 inBorderColor;\n"
+                "layout(location=3) in vec2 inShape;\n"
+                "out vec2 localPos;\n"
+                "flat out vec2 halfSize;\n"
+                "flat out vec2 shape;\n"
+                "flat out vec4 backgroundColor;\n"
+                "flat out vec4 borderColor;\n"
+                "void main() {\n"
+                "    vec2 corner = vec2(float(gl_VertexID & 1), float(gl_VertexID >> 1));\n"
+                "    vec2 position = inRect.xy - vec2(1.0) + corner * (inRect.zw + vec2(2.0));\n"
+                "    gl_Position = projectionMatrix * vec4(position, 0, 1);\n"
+                "    halfSize = inRect.zw * 0.5;\n"
+                "    localPos = position - inRect.xy - halfSize;\n"
+                "    shape = inShape;\n"
+                "    backgroundColor = inBackgroundColor;\n"
+                "    borderColor = inBorderColor;\n"
+                "}";
+        }
+
+        // The distance to the edge of the rounded rectangle is negative inside the shape. The shape contains the radius and
+        // the border thickness. The width of a pixel in the distance field decides how wide the anti-aliased edges are.
         const GLchar* fragmentShaderSource =
         {
             "#version 330 core\n"
-            "uniform sampler2D uTexture;\n"
-            "in vec4 color;\n"
-            "in vec2 texCoord;\n"
+            "in vec2 localPos;\n"
+            "flat in vec2 halfSize;\n"
+            "flat in vec2 shape;\n"
+            "flat in vec4 backgroundColor;\n"
+            "flat in vec4 borderColor;\n"
             "out vec4 outColor;\n"
             "void main() {\n"
-            "    outColor = texture(uTexture, texCoord) * color;\n"
+            "    vec2 q = abs(localPos) - halfSize + vec2(shape.x);\n"
+            "    float dist = length(max(q, 0.0)) + min(max(q.x, q.y), 0.0) - shape.x;\n"
+            "    float pixelWidth = max(fwidth(dist), 0.0001);\n"
+            "    float coverage = clamp(0.5 - dist / pixelWidth, 0.0, 1.0);\n"
+            "    float border = (shape.y > 0.0) ? clamp(0.5 + (dist + shape.y) / pixelWidth, 0.0, 1.0) : 0.0;\n"
+            "    vec4 color = mix(backgroundColor, borderColor, border);\n"
+            "    outColor = vec4(color.rgb, color.a * coverage);\n"
             "}"
         };
 
-        // Create the vertex shader
-        GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
-        if (vertexShader == 0)
-            throw Exception{U"Failed to create shaders in BackendRenderTargetOpenGL3. glCreateShader(GL_VERTEX_SHADER) returned 0."};
-
-        TGUI_GL_CHECK(glShaderSource(vertexShader, 1, &vertexShaderSource, nullptr));
-        TGUI_GL_CHECK(glCompileShader(vertexShader));
-
-        GLint vertexShaderCompiled = GL_FALSE;
-        TGUI_GL_CHECK(glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &vertexShaderCompiled));
-        if (vertexShaderCompiled != GL_TRUE)
-            throw Exception{U"Failed to create shaders in BackendRenderTargetOpenGL3. Failed to compile vertex shader."};
-
-        // Create the fragment shader
-        GLuint fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
-        if (fragmentShader == 0)
-            throw Exception{U"Failed to create shaders in BackendRenderTargetOpenGL3. glCreateShader(GL_FRAGMENT_SHADER) returned 0."};
-
-        TGUI_GL_CHECK(glShaderSource(fragmentShader, 1, &fragmentShaderSource, nullptr));
-        TGUI_GL_CHECK(glCompileShader(fragmentShader));
-
-        GLint fragmentShaderCompiled = GL_FALSE;
-        TGUI_GL_CHECK(glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &fragmentShaderCompiled));
-        if (fragmentShaderCompiled != GL_TRUE)
-            throw Exception{U"Failed to create shaders in BackendRenderTargetOpenGL3. Failed to compile fragment shader."};
-
-        // Link the vertex and fragment shader into a program
-        GLuint programId = glCreateProgram();
-        TGUI_GL_CHECK(glAttachShader(programId, vertexShader));
-        TGUI_GL_CHECK(glAttachShader(programId, fragmentShader));
-        TGUI_GL_CHECK(glLinkProgram(programId));
-
-        GLint programLinked = GL_TRUE;
-        TGUI_GL_CHECK(glGetProgramiv(programId, GL_LINK_STATUS, &programLinked));
-        if (programLinked != GL_TRUE)
-            throw Exception{U"Failed to create shaders in BackendRenderTargetOpenGL3. Failed to link the shaders."};
-
-        return programId;
+        return createShaderProgram(vertexShaderSource, fragmentShaderSource);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     BackendRenderTargetOpenGL3::BackendRenderTargetOpenGL3() :
-        m_shaderProgram(createShaderProgram())
+        m_shaderProgram(createTriangleShaderProgram(TextureFragmentShaderSource)),
+        m_quadShaderProgram(createQuadShaderProgram(TextureFragmentShaderSource)),
+        m_shapeShaderProgram(createShapeShaderProgram()),
+        m_distanceFieldShaderProgram(createTriangleShaderProgram(DistanceFieldFragmentShaderSource)),
+        m_distanceFieldQuadShaderProgram(createQuadShaderProgram(DistanceFieldFragmentShaderSource))
     {
         TGUI_ASSERT(isBackendSet(), "BackendRenderTargetOpenGL3 can't be created when there is no system backend initialized (was a gui created yet?)");
         TGUI_ASSERT(getBackend()->getRenderer(), "BackendRenderTargetOpenGL3 can't be created when there is no backend renderer (was a gui attached to a window yet?)");
 
         // If our OpenGL version didn't support the layout qualifier in GLSL then we need to query the location
         if (!TGUI_GLAD_GL_VERSION_4_3)
+        {
             m_projectionMatrixShaderUniformLocation = glGetUniformLocation(m_shaderProgram, "projectionMatrix");
+            m_quadProjectionMatrixShaderUniformLocation = glGetUniformLocation(m_quadShaderProgram, "projectionMatrix");
+            m_shapeProjectionMatrixShaderUniformLocation = glGetUniformLocation(m_shapeShaderProgram, "projectionMatrix");
+            m_distanceFieldProjectionMatrixShaderUniformLocation = glGetUniformLocation(m_distanceFieldShaderProgram, "projectionMatrix");
+            m_distanceFieldQuadProjectionMatrixShaderUniformLocation = glGetUniformLocation(m_distanceFieldQuadShaderProgram, "projectionMatrix");
+        }
+
+        m_distanceFieldEdgeShaderUniformLocation = glGetUniformLocation(m_distanceFieldShaderProgram, "distanceFieldEdge");
+        m_distanceFieldQuadEdgeShaderUniformLocation = glGetUniformLocation(m_distanceFieldQuadShaderProgram, "distanceFieldEdge");
 
         createBuffers();
 
@@ -155,9 +328,15 @@ namespace tgui
 
     BackendRenderTargetOpenGL3::~BackendRenderTargetOpenGL3()
     {
-        TGUI_GL_CHECK(glDeleteBuffers(1, &m_vertexBuffer));
-        TGUI_GL_CHECK(glDeleteBuffers(1, &m_indexBuffer));
+        // The vertex, index, quad and shape buffers are deleted by their own destructors
         TGUI_GL_CHECK(glDeleteVertexArrays(1, &m_vertexArray));
+        TGUI_GL_CHECK(glDeleteVertexArrays(1, &m_quadVertexArray));
+        TGUI_GL_CHECK(glDeleteVertexArrays(1, &m_shapeVertexArray));
+        TGUI_GL_CHECK(glDeleteProgram(m_shaderProgram));
+        TGUI_GL_CHECK(glDeleteProgram(m_quadShaderProgram));
+        TGUI_GL_CHECK(glDeleteProgram(m_shapeShaderProgram));
+        TGUI_GL_CHECK(glDeleteProgram(m_distanceFieldShaderProgram));
+        TGUI_GL_CHECK(glDeleteProgram(m_distanceFieldQuadShaderProgram));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -234,18 +413,41 @@ namespace tgui
                                                static_cast<int>(m_viewport.width), static_cast<int>(m_viewport.height)};
         TGUI_GL_CHECK(glViewport(viewportGL[0], viewportGL[1], viewportGL[2], viewportGL[3]));
         TGUI_GL_CHECK(glScissor(viewportGL[0], viewportGL[1], viewportGL[2], viewportGL[3]));
+
+        // The vertices, quads and shapes are already transformed when they are added to the batch, so the shaders only need the projection
+        TGUI_GL_CHECK(glUseProgram(m_distanceFieldQuadShaderProgram));
+        glUniformMatrix4fv(m_distanceFieldQuadProjectionMatrixShaderUniformLocation, 1, GL_FALSE, m_projectionTransform.getMatrix().data());
+        TGUI_GL_CHECK(glUseProgram(m_distanceFieldShaderProgram));
+        glUniformMatrix4fv(m_distanceFieldProjectionMatrixShaderUniformLocation, 1, GL_FALSE, m_projectionTransform.getMatrix().data());
+        TGUI_GL_CHECK(glUseProgram(m_shapeShaderProgram));
+        glUniformMatrix4fv(m_shapeProjectionMatrixShaderUniformLocation, 1, GL_FALSE, m_projectionTransform.getMatrix().data());
+        TGUI_GL_CHECK(glUseProgram(m_quadShaderProgram));
+        glUniformMatrix4fv(m_quadProjectionMatrixShaderUniformLocation, 1, GL_FALSE, m_projectionTransform.getMatrix().data());
         TGUI_GL_CHECK(glUseProgram(m_shaderProgram));
+        glUniformMatrix4fv(m_projectionMatrixShaderUniformLocation, 1, GL_FALSE, m_projectionTransform.getMatrix().data());
+
         TGUI_GL_CHECK(glBindVertexArray(m_vertexArray));
-        TGUI_GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer));
-        TGUI_GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indexBuffer));
+        TGUI_GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer.getBuffer()));
+        TGUI_GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indexBuffer.getBuffer()));
+        m_boundProgram = BoundProgram::Triangles;
 
         // Don't make any assumptions about the currently set texture
         m_currentTexture = nullptr;
-        TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_emptyTexture->getInternalTexture()));
+        m_batchDistanceFieldEdge = 0;
+        m_boundTexture = m_emptyTexture->getInternalTexture();
+        TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_boundTexture));
 
         // Draw the widgets
+        m_batchVertices.clear();
+        m_batchIndices.clear();
+        m_batchQuads.clear();
+        m_batchShapes.clear();
+        m_frameStatistics = {};
         root->draw(*this, {});
 
+        // Draw whatever is still in the batch
+        finishDrawing();
+
         m_currentTexture = nullptr;
 
         // Restore the old state
@@ -276,49 +478,146 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BackendRenderTargetOpenGL3::drawBorders(const RenderStates& states, const Borders& borders, Vector2f size, Color color)
+    {
+        const std::array<float, 16>& matrix = states.transform.getMatrix();
+        if ((matrix[1] != 0) || (matrix[4] != 0))
+            return BackendRenderTarget::drawBorders(states, borders, size, color);
+
+        setBatchTexture(nullptr);
+        ++m_frameStatistics.vertexArrays;
+
+        // The left and right borders cover the full height, the top and bottom borders fit in between them
+        const auto vertexColor = Vertex::Color(color);
+        const float middleWidth = size.x - borders.getLeft() - borders.getRight();
+        addQuad(states.transform, {0, 0, borders.getLeft(), size.y}, vertexColor);
+        addQuad(states.transform, {size.x - borders.getRight(), 0, borders.getRight(), size.y}, vertexColor);
+        addQuad(states.transform, {borders.getLeft(), 0, middleWidth, borders.getTop()}, vertexColor);
+        addQuad(states.transform, {borders.getLeft(), size.y - borders.getBottom(), middleWidth, borders.getBottom()}, vertexColor);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::drawCircle(const RenderStates& states, float size, const Color& backgroundColor, float borderThickness, const Color& borderColor)
+    {
+        // A positive border lies outside the circle, so the shape becomes larger
+        const float radius = size / 2.f;
+        bool added;
+        if (borderThickness > 0)
+            added = addShape(states.transform, {-borderThickness, -borderThickness, size + 2*borderThickness, size + 2*borderThickness},
+                             radius + borderThickness, borderThickness, backgroundColor, borderColor);
+        else
+            added = addShape(states.transform, {0, 0, size, size}, radius, -borderThickness, backgroundColor, borderColor);
+
+        if (!added)
+            BackendRenderTarget::drawCircle(states, size, backgroundColor, borderThickness, borderColor);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::drawRoundedRectangle(const RenderStates& states, const Vector2f& size, const Color& backgroundColor,
+                                                          float radius, const Borders& borders, const Color& borderColor)
+    {
+        // Radius can never be larger than half the width or height
+        const float clampedRadius = std::max(0.f, std::min({radius, size.x / 2, size.y / 2}));
+        if (!addShape(states.transform, {{0, 0}, size}, clampedRadius, std::max(0.f, borders.getLeft()), backgroundColor, borderColor))
+            BackendRenderTarget::drawRoundedRectangle(states, size, backgroundColor, radius, borders, borderColor);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendRenderTargetOpenGL3::drawVertexArray(const RenderStates& states, const Vertex* vertices,
         std::size_t vertexCount, const unsigned int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture)
     {
-        // Change the bound texture if it changed
-        if (m_currentTexture != texture)
-        {
-            if (texture)
-            {
-                TGUI_ASSERT(std::dynamic_pointer_cast<BackendTextureOpenGL3>(texture), "BackendRenderTargetOpenGL3 requires textures of type BackendTextureOpenGL3");
-                m_currentTexture = std::static_pointer_cast<BackendTextureOpenGL3>(texture);
+        addVertexArray(states, vertices, vertexCount, indices, indexCount, texture, 0);
+    }
 
-                TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_currentTexture->getInternalTexture()));
-            }
-            else
-            {
-                m_currentTexture = nullptr;
-                TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_emptyTexture->getInternalTexture()));
-            }
-        }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        // Load the data into the vertex buffer. After some experimenting, orphaning the buffer and allocating a new one each time
-        // was (suprisingly) faster than creating a larger buffer and only writing to non-overlapping ranges within a frame.
-        // Batch rendering (and re-arranging draw calls to be better batchable) would be much faster though.
-        TGUI_GL_CHECK(glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(vertexCount * sizeof(Vertex)), vertices, GL_DYNAMIC_DRAW));
+    void BackendRenderTargetOpenGL3::addVertexArray(const RenderStates& states, const Vertex* vertices, std::size_t vertexCount,
+        const unsigned int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture, float distanceFieldEdge)
+    {
+        setBatchTexture(texture, distanceFieldEdge);
 
-        const Transform finalTransform = m_projectionTransform * states.transform;
-        glUniformMatrix4fv(m_projectionMatrixShaderUniformLocation, 1, GL_FALSE, finalTransform.getMatrix().data());
+        ++m_frameStatistics.vertexArrays;
 
-        if (indices)
+        // Shapes that were added earlier have to be drawn before these vertices
+        if (!m_batchShapes.empty())
+            flushBatch();
+
+        // Rectangles, sprites and text consist of quads, which are much smaller to upload as instances than as vertices
+        if (addQuads(states.transform, vertices, indices, indices ? indexCount : vertexCount))
+            return;
+
+        // Triangles and quads are drawn with different shaders, so they can't be part of the same draw call
+        if (!m_batchQuads.empty())
+            flushBatch();
+
+        // Transform the vertices on the CPU so that draws with a different transform can still be combined.
+        // Only the projection is left for the shader, which stays the same during the whole frame.
+        const std::size_t firstVertex = m_batchVertices.size();
+        m_batchVertices.resize(firstVertex + vertexCount);
+        for (std::size_t i = 0; i < vertexCount; ++i)
         {
-            // Load the data into the index buffer
-            TGUI_GL_CHECK(glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(indexCount * sizeof(GLuint)), indices, GL_STREAM_DRAW));
+            m_batchVertices[firstVertex + i].position = states.transform.transformPoint(vertices[i].position);
+            m_batchVertices[firstVertex + i].color = vertices[i].color;
+            m_batchVertices[firstVertex + i].texCoords = vertices[i].texCoords;
+        }
 
-            TGUI_GL_CHECK(glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(indexCount), GL_UNSIGNED_INT, nullptr));
+        // The batch is always drawn with indices, so they have to be generated when none were given
+        const auto baseIndex = static_cast<unsigned int>(firstVertex);
+        const std::size_t firstIndex = m_batchIndices.size();
+        if (indices)
+        {
+            m_batchIndices.resize(firstIndex + indexCount);
+            for (std::size_t i = 0; i < indexCount; ++i)
+                m_batchIndices[firstIndex + i] = baseIndex + indices[i];
         }
         else // No indices were given, all vertices need to be drawn in the order they were provided
-            TGUI_GL_CHECK(glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(vertexCount)));
+        {
+            m_batchIndices.resize(firstIndex + vertexCount);
+            std::iota(m_batchIndices.begin() + static_cast<std::ptrdiff_t>(firstIndex), m_batchIndices.end(), baseIndex);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::drawTextVertices(const RenderStates& states, const std::vector<Vertex>& vertices,
+                                                      const std::shared_ptr<BackendTexture>& texture, float distanceFieldEdge)
+    {
+        addVertexArray(states, vertices.data(), vertices.size(), nullptr, 0, texture, distanceFieldEdge);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const BatchStatistics& BackendRenderTargetOpenGL3::getBatchStatistics() const
+    {
+        return m_lastFrameStatistics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    StreamBufferStatistics BackendRenderTargetOpenGL3::getStreamBufferStatistics() const
+    {
+        StreamBufferStatistics statistics;
+        m_vertexBuffer.addStatistics(statistics);
+        m_indexBuffer.addStatistics(statistics);
+        m_quadBuffer.addStatistics(statistics);
+        m_shapeBuffer.addStatistics(statistics);
+        return statistics;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void BackendRenderTargetOpenGL3::updateClipping(FloatRect clipRect, FloatRect clipViewport)
     {
+        // Everything that was added before the clipping changed still has to be drawn with the old scissor rectangle
+        if (!m_batchIndices.empty() || !m_batchQuads.empty() || !m_batchShapes.empty())
+        {
+            flushBatch();
+            ++m_frameStatistics.clippingFlushes;
+        }
+
         if ((clipViewport.width > 0) && (clipViewport.height > 0) && (clipRect.width > 0) && (clipRect.height > 0))
         {
             m_pixelsPerPoint = {clipViewport.width / clipRect.width, clipViewport.height / clipRect.height};
@@ -336,23 +635,391 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BackendRenderTargetOpenGL3::flushBatch()
+    {
+        if (m_batchIndices.empty() && m_batchQuads.empty() && m_batchShapes.empty())
+            return;
+
+        const unsigned int textureId = m_currentTexture ? m_currentTexture->getInternalTexture() : m_emptyTexture->getInternalTexture();
+        if (m_boundTexture != textureId)
+        {
+            m_boundTexture = textureId;
+            TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, textureId));
+        }
+
+        // Triangles are always older than quads when both are in the batch, so they are drawn first
+        if (!m_batchIndices.empty())
+        {
+            if (m_batchDistanceFieldEdge != 0)
+            {
+                if (m_boundProgram != BoundProgram::DistanceFieldTriangles)
+                {
+                    m_boundProgram = BoundProgram::DistanceFieldTriangles;
+                    TGUI_GL_CHECK(glUseProgram(m_distanceFieldShaderProgram));
+                    TGUI_GL_CHECK(glBindVertexArray(m_vertexArray));
+                }
+
+                TGUI_GL_CHECK(glUniform1f(m_distanceFieldEdgeShaderUniformLocation, m_batchDistanceFieldEdge));
+            }
+            else if (m_boundProgram != BoundProgram::Triangles)
+            {
+                m_boundProgram = BoundProgram::Triangles;
+                TGUI_GL_CHECK(glUseProgram(m_shaderProgram));
+                TGUI_GL_CHECK(glBindVertexArray(m_vertexArray));
+            }
+
+            TGUI_GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer.getBuffer()));
+
+            // Write the data behind what was already written to the ring buffers, so that the driver never has to reallocate them
+            std::size_t firstVertex = 0;
+            void* vertexData = m_vertexBuffer.map(m_batchVertices.size(), firstVertex);
+            std::memcpy(vertexData, m_batchVertices.data(), m_batchVertices.size() * sizeof(Vertex));
+            m_vertexBuffer.unmap();
+
+            if (m_vertexBuffer.wasRecreated())
+                setVertexAttribs();
+
+            // The indices are relative to the start of the batch, so they need to be moved to where the vertices ended up in the buffer
+            std::size_t firstIndex = 0;
+            auto* indexData = static_cast<GLuint*>(m_indexBuffer.map(m_batchIndices.size(), firstIndex));
+            const auto baseIndex = static_cast<GLuint>(firstVertex);
+            for (std::size_t i = 0; i < m_batchIndices.size(); ++i)
+                indexData[i] = baseIndex + m_batchIndices[i];
+            m_indexBuffer.unmap();
+
+            // The index buffer binding is part of the vertex array object, which still refers to the old buffer
+            if (m_indexBuffer.wasRecreated())
+                TGUI_GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indexBuffer.getBuffer()));
+
+            TGUI_GL_CHECK(glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(m_batchIndices.size()), GL_UNSIGNED_INT,
+                                         reinterpret_cast<const GLvoid*>(firstIndex * sizeof(GLuint))));
+
+            // The ring buffers may only reuse the written sections once the GPU has executed this draw call
+            m_vertexBuffer.fence();
+            m_indexBuffer.fence();
+
+            ++m_frameStatistics.drawCalls;
+            m_frameStatistics.vertices += m_batchVertices.size();
+            m_frameStatistics.indices += m_batchIndices.size();
+
+            // Clearing keeps the memory, so the vectors stop allocating after the first few frames
+            m_batchVertices.clear();
+            m_batchIndices.clear();
+        }
+
+        if (!m_batchQuads.empty())
+        {
+            if (m_batchDistanceFieldEdge != 0)
+            {
+                if (m_boundProgram != BoundProgram::DistanceFieldQuads)
+                {
+                    m_boundProgram = BoundProgram::DistanceFieldQuads;
+                    TGUI_GL_CHECK(glUseProgram(m_distanceFieldQuadShaderProgram));
+                    TGUI_GL_CHECK(glBindVertexArray(m_quadVertexArray));
+                }
+
+                TGUI_GL_CHECK(glUniform1f(m_distanceFieldQuadEdgeShaderUniformLocation, m_batchDistanceFieldEdge));
+            }
+            else if (m_boundProgram != BoundProgram::Quads)
+            {
+                m_boundProgram = BoundProgram::Quads;
+                TGUI_GL_CHECK(glUseProgram(m_quadShaderProgram));
+                TGUI_GL_CHECK(glBindVertexArray(m_quadVertexArray));
+            }
+
+            TGUI_GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, m_quadBuffer.getBuffer()));
+
+            std::size_t firstQuad = 0;
+            void* quadData = m_quadBuffer.map(m_batchQuads.size(), firstQuad);
+            std::memcpy(quadData, m_batchQuads.data(), m_batchQuads.size() * sizeof(QuadInstance));
+            m_quadBuffer.unmap();
+
+            // Instead of relying on glDrawArraysInstancedBaseInstance (OpenGL 4.2), the attributes start at the first instance
+            setQuadAttribs(firstQuad * sizeof(QuadInstance));
+
+            TGUI_GL_CHECK(glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, static_cast<GLsizei>(m_batchQuads.size())));
+            m_quadBuffer.fence();
+
+            ++m_frameStatistics.drawCalls;
+            m_frameStatistics.quads += m_batchQuads.size();
+
+            m_batchQuads.clear();
+        }
+
+        // Shapes never share a batch with triangles or quads, they are only part of the same flush to keep this function simple
+        if (!m_batchShapes.empty())
+        {
+            if (m_boundProgram != BoundProgram::Shapes)
+            {
+                m_boundProgram = BoundProgram::Shapes;
+                TGUI_GL_CHECK(glUseProgram(m_shapeShaderProgram));
+                TGUI_GL_CHECK(glBindVertexArray(m_shapeVertexArray));
+            }
+
+            TGUI_GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, m_shapeBuffer.getBuffer()));
+
+            std::size_t firstShape = 0;
+            void* shapeData = m_shapeBuffer.map(m_batchShapes.size(), firstShape);
+            std::memcpy(shapeData, m_batchShapes.data(), m_batchShapes.size() * sizeof(ShapeInstance));
+            m_shapeBuffer.unmap();
+
+            setShapeAttribs(firstShape * sizeof(ShapeInstance));
+
+            TGUI_GL_CHECK(glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, static_cast<GLsizei>(m_batchShapes.size())));
+            m_shapeBuffer.fence();
+
+            ++m_frameStatistics.drawCalls;
+            m_frameStatistics.shapes += m_batchShapes.size();
+
+            m_batchShapes.clear();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::setBatchTexture(const std::shared_ptr<BackendTexture>& texture, float distanceFieldEdge)
+    {
+        // Vertices with a different texture can't be part of the same draw call.
+        // Text with distance fields uses a different shader, and its outline needs a different value for the uniform.
+        if ((m_currentTexture == texture) && (m_batchDistanceFieldEdge == distanceFieldEdge))
+            return;
+
+        if (!m_batchIndices.empty() || !m_batchQuads.empty() || !m_batchShapes.empty())
+        {
+            flushBatch();
+            ++m_frameStatistics.textureFlushes;
+        }
+
+        if (texture)
+        {
+            TGUI_ASSERT(std::dynamic_pointer_cast<BackendTextureOpenGL3>(texture), "BackendRenderTargetOpenGL3 requires textures of type BackendTextureOpenGL3");
+            m_currentTexture = std::static_pointer_cast<BackendTextureOpenGL3>(texture);
+        }
+        else
+            m_currentTexture = nullptr;
+
+        m_batchDistanceFieldEdge = distanceFieldEdge;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTargetOpenGL3::addQuads(const Transform& transform, const Vertex* vertices, const unsigned int* indices, std::size_t count)
+    {
+        // A rotated quad is no longer axis-aligned after the transformation
+        const std::array<float, 16>& matrix = transform.getMatrix();
+        if ((matrix[1] != 0) || (matrix[4] != 0) || (count == 0) || (count % 6 != 0))
+            return false;
+
+        const std::size_t firstQuad = m_batchQuads.size();
+        m_batchQuads.reserve(firstQuad + (count / 6));
+        for (std::size_t i = 0; i < count; i += 6)
+        {
+            std::array<const Vertex*, 6> quadVertices;
+            for (std::size_t j = 0; j < 6; ++j)
+                quadVertices[j] = indices ? &vertices[indices[i + j]] : &vertices[i + j];
+
+            Vector2f minPos = quadVertices[0]->position;
+            Vector2f maxPos = quadVertices[0]->position;
+            for (const Vertex* vertex : quadVertices)
+            {
+                minPos.x = std::min(minPos.x, vertex->position.x);
+                minPos.y = std::min(minPos.y, vertex->position.y);
+                maxPos.x = std::max(maxPos.x, vertex->position.x);
+                maxPos.y = std::max(maxPos.y, vertex->position.y);
+            }
+
+            // Every vertex has to lie on a corner, have the same color, and have the texture coordinate that belongs to that corner
+            bool isQuad = (minPos.x < maxPos.x) && (minPos.y < maxPos.y);
+            std::array<unsigned int, 2> triangleCorners = {0, 0};
+            std::array<Vector2f, 4> cornerTexCoords;
+            unsigned int cornersWithTexCoords = 0;
+            const Vertex::Color color = quadVertices[0]->color;
+            for (std::size_t j = 0; (j < 6) && isQuad; ++j)
+            {
+                const Vertex& vertex = *quadVertices[j];
+                const bool isRight = (vertex.position.x == maxPos.x);
+                const bool isBottom = (vertex.position.y == maxPos.y);
+                if ((!isRight && (vertex.position.x != minPos.x)) || (!isBottom && (vertex.position.y != minPos.y))
+                 || (vertex.color.red != color.red) || (vertex.color.green != color.green)
+                 || (vertex.color.blue != color.blue) || (vertex.color.alpha != color.alpha))
+                {
+                    isQuad = false;
+                    break;
+                }
+
+                const unsigned int corner = (isRight ? 1u : 0u) + (isBottom ? 2u : 0u);
+                triangleCorners[j / 3] |= (1u << corner);
+
+                if (cornersWithTexCoords & (1u << corner))
+                    isQuad = (cornerTexCoords[corner] == vertex.texCoords);
+                else
+                {
+                    cornersWithTexCoords |= (1u << corner);
+                    cornerTexCoords[corner] = vertex.texCoords;
+                }
+            }
+
+            // Both triangles need 3 different corners, and they have to be split along a diagonal so that they don't overlap.
+            // The corner that each triangle is missing is then the opposite corner of the other triangle.
+            if (isQuad)
+            {
+                const unsigned int missingCorners = (triangleCorners[0] ^ 0xFu) | ((triangleCorners[1] ^ 0xFu) << 4);
+                isQuad = (missingCorners == 0x81) || (missingCorners == 0x18) || (missingCorners == 0x42) || (missingCorners == 0x24);
+            }
+
+            // The texture coordinates have to be axis-aligned as well, as the shader interpolates them between 2 corners
+            if (isQuad)
+            {
+                isQuad = (cornerTexCoords[0].x == cornerTexCoords[2].x) && (cornerTexCoords[1].x == cornerTexCoords[3].x)
+                      && (cornerTexCoords[0].y == cornerTexCoords[1].y) && (cornerTexCoords[2].y == cornerTexCoords[3].y);
+            }
+
+            if (!isQuad)
+            {
+                m_batchQuads.resize(firstQuad);
+                return false;
+            }
+
+            const Vector2f topLeft = transform.transformPoint(minPos);
+            const Vector2f bottomRight = transform.transformPoint(maxPos);
+            m_batchQuads.push_back({{topLeft, bottomRight - topLeft},
+                                    {cornerTexCoords[0], cornerTexCoords[3] - cornerTexCoords[0]},
+                                    color});
+        }
+
+        // Triangles that were added earlier have to be drawn before these quads
+        if (!m_batchIndices.empty())
+        {
+            std::vector<QuadInstance> newQuads(m_batchQuads.begin() + static_cast<std::ptrdiff_t>(firstQuad), m_batchQuads.end());
+            m_batchQuads.resize(firstQuad);
+            flushBatch();
+            m_batchQuads = std::move(newQuads);
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::addQuad(const Transform& transform, FloatRect rect, Vertex::Color color)
+    {
+        if ((rect.width <= 0) || (rect.height <= 0))
+            return;
+
+        // Triangles, shapes and quads are drawn with different shaders, so they can't be part of the same draw call
+        if (!m_batchIndices.empty() || !m_batchShapes.empty())
+            flushBatch();
+
+        const Vector2f topLeft = transform.transformPoint(rect.getPosition());
+        const Vector2f bottomRight = transform.transformPoint(rect.getPosition() + rect.getSize());
+        m_batchQuads.push_back({{topLeft, bottomRight - topLeft}, {0, 0, 0, 0}, color});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTargetOpenGL3::addShape(const Transform& transform, FloatRect rect, float radius, float borderThickness,
+                                              const Color& backgroundColor, const Color& borderColor)
+    {
+        // The distance field only stays correct when the shape is scaled by the same amount in both directions
+        const std::array<float, 16>& matrix = transform.getMatrix();
+        if ((matrix[1] != 0) || (matrix[4] != 0) || (std::abs(matrix[0]) != std::abs(matrix[5])) || (matrix[0] == 0))
+            return false;
+
+        if ((rect.width <= 0) || (rect.height <= 0))
+            return true;
+
+        // Shapes have their own shader, so nothing else can be part of the same draw call
+        if (!m_batchIndices.empty() || !m_batchQuads.empty())
+            flushBatch();
+
+        // The transform may mirror the shape, in which case the corners have to be swapped to keep the size positive
+        const Vector2f corner1 = transform.transformPoint(rect.getPosition());
+        const Vector2f corner2 = transform.transformPoint(rect.getPosition() + rect.getSize());
+        const Vector2f topLeft = {std::min(corner1.x, corner2.x), std::min(corner1.y, corner2.y)};
+        const Vector2f bottomRight = {std::max(corner1.x, corner2.x), std::max(corner1.y, corner2.y)};
+
+        const float scale = std::abs(matrix[0]);
+        m_batchShapes.push_back({{topLeft, bottomRight - topLeft}, Vertex::Color(backgroundColor), Vertex::Color(borderColor),
+                                 radius * scale, borderThickness * scale});
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::finishDrawing()
+    {
+        flushBatch();
+
+        m_lastFrameStatistics = m_frameStatistics;
+        m_frameStatistics = {};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendRenderTargetOpenGL3::createBuffers()
     {
         TGUI_GL_CHECK(glGenVertexArrays(1, &m_vertexArray));
         TGUI_GL_CHECK(glBindVertexArray(m_vertexArray));
 
+        // Keep the buffers mapped when OpenGL 4.4 is available, otherwise map the part that is written each time
+        const StreamBufferOpenGL::Mode mode = TGUI_GLAD_GL_VERSION_4_4 ? StreamBufferOpenGL::Mode::Persistent : StreamBufferOpenGL::Mode::MapUnsynchronized;
+
         // Create the vertex buffer
-        TGUI_GL_CHECK(glGenBuffers(1, &m_vertexBuffer));
-        TGUI_GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer));
+        m_vertexBuffer.create(GL_ARRAY_BUFFER, sizeof(Vertex), 4 * 16384, mode);
 
         // Create the index buffer
-        TGUI_GL_CHECK(glGenBuffers(1, &m_indexBuffer));
-        TGUI_GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indexBuffer));
+        m_indexBuffer.create(GL_ELEMENT_ARRAY_BUFFER, sizeof(GLuint), 4 * 24576, mode);
 
         TGUI_GL_CHECK(glEnableVertexAttribArray(0)); // Position
         TGUI_GL_CHECK(glEnableVertexAttribArray(1)); // Color
         TGUI_GL_CHECK(glEnableVertexAttribArray(2)); // TexCoord
 
+        // The attributes are set here, so the vertex buffer doesn't have to be reported as new on the first draw
+        setVertexAttribs();
+        (void)m_vertexBuffer.wasRecreated();
+        (void)m_indexBuffer.wasRecreated();
+
+        // Quads are drawn as a triangle strip of 4 vertices that is instanced once per quad.
+        // The vertices have no data, the shader picks the corner of the quad based on gl_VertexID.
+        TGUI_GL_CHECK(glGenVertexArrays(1, &m_quadVertexArray));
+        TGUI_GL_CHECK(glBindVertexArray(m_quadVertexArray));
+
+        m_quadBuffer.create(GL_ARRAY_BUFFER, sizeof(QuadInstance), 4 * 8192, mode);
+
+        TGUI_GL_CHECK(glEnableVertexAttribArray(0)); // Rect
+        TGUI_GL_CHECK(glEnableVertexAttribArray(1)); // TexRect
+        TGUI_GL_CHECK(glEnableVertexAttribArray(2)); // Color
+        TGUI_GL_CHECK(glVertexAttribDivisor(0, 1));
+        TGUI_GL_CHECK(glVertexAttribDivisor(1, 1));
+        TGUI_GL_CHECK(glVertexAttribDivisor(2, 1));
+
+        // Shapes are drawn in the same way as quads, with different data per instance
+        TGUI_GL_CHECK(glGenVertexArrays(1, &m_shapeVertexArray));
+        TGUI_GL_CHECK(glBindVertexArray(m_shapeVertexArray));
+
+        m_shapeBuffer.create(GL_ARRAY_BUFFER, sizeof(ShapeInstance), 4 * 1024, mode);
+
+        TGUI_GL_CHECK(glEnableVertexAttribArray(0)); // Rect
+        TGUI_GL_CHECK(glEnableVertexAttribArray(1)); // BackgroundColor
+        TGUI_GL_CHECK(glEnableVertexAttribArray(2)); // BorderColor
+        TGUI_GL_CHECK(glEnableVertexAttribArray(3)); // Radius and border thickness
+        TGUI_GL_CHECK(glVertexAttribDivisor(0, 1));
+        TGUI_GL_CHECK(glVertexAttribDivisor(1, 1));
+        TGUI_GL_CHECK(glVertexAttribDivisor(2, 1));
+        TGUI_GL_CHECK(glVertexAttribDivisor(3, 1));
+
+        TGUI_GL_CHECK(glBindVertexArray(0));
+
+        TGUI_GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, 0));
+        TGUI_GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::setVertexAttribs()
+    {
+        TGUI_GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer.getBuffer()));
+
         // Position is stored as x,y in the first 2 floats
         // Color is stored as r,g,b,a in the next 4 bytes
         // Texture coordinate is stored as u,v in the last 2 floats
@@ -360,11 +1027,33 @@ namespace tgui
         TGUI_GL_CHECK(glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), reinterpret_cast<GLvoid*>(0)));
         TGUI_GL_CHECK(glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex), reinterpret_cast<GLvoid*>(8)));
         TGUI_GL_CHECK(glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), reinterpret_cast<GLvoid*>(8 + 4)));
+    }
 
-        TGUI_GL_CHECK(glBindVertexArray(0));
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        TGUI_GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, 0));
-        TGUI_GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0));
+    void BackendRenderTargetOpenGL3::setQuadAttribs(std::size_t offset)
+    {
+        // Rect is stored as left,top,width,height in the first 4 floats
+        // TexRect is stored as left,top,width,height in the next 4 floats
+        // Color is stored as r,g,b,a in the last 4 bytes
+        static_assert(sizeof(QuadInstance) == 16 + 16 + 4, "Size of QuadInstance has to match the data");
+        TGUI_GL_CHECK(glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, sizeof(QuadInstance), reinterpret_cast<GLvoid*>(offset)));
+        TGUI_GL_CHECK(glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, sizeof(QuadInstance), reinterpret_cast<GLvoid*>(offset + 16)));
+        TGUI_GL_CHECK(glVertexAttribPointer(2, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(QuadInstance), reinterpret_cast<GLvoid*>(offset + 32)));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::setShapeAttribs(std::size_t offset)
+    {
+        // Rect is stored as left,top,width,height in the first 4 floats
+        // BackgroundColor and BorderColor are stored as r,g,b,a in the next 8 bytes
+        // Radius and border thickness are stored in the last 2 floats
+        static_assert(sizeof(ShapeInstance) == 16 + 4 + 4 + 8, "Size of ShapeInstance has to match the data");
+        TGUI_GL_CHECK(glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, sizeof(ShapeInstance), reinterpret_cast<GLvoid*>(offset)));
+        TGUI_GL_CHECK(glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(ShapeInstance), reinterpret_cast<GLvoid*>(offset + 16)));
+        TGUI_GL_CHECK(glVertexAttribPointer(2, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(ShapeInstance), reinterpret_cast<GLvoid*>(offset + 16 + 4)));
+        TGUI_GL_CHECK(glVertexAttribPointer(3, 2, GL_FLOAT, GL_FALSE, sizeof(ShapeInstance), reinterpret_cast<GLvoid*>(offset + 16 + 8)));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
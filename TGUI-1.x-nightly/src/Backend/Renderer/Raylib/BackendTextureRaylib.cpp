@@ -79,6 +79,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool BackendTextureRaylib::updatePixels(UIntRect rect, const std::uint8_t* pixels)
+    {
+        if (!m_texture.id)
+            return false;
+
+        TGUI_ASSERT((rect.left + rect.width <= m_imageSize.x) && (rect.top + rect.height <= m_imageSize.y), "Rect must lie inside the texture in BackendTextureRaylib::updatePixels");
+
+        const Rectangle raylibRect{static_cast<float>(rect.left), static_cast<float>(rect.top), static_cast<float>(rect.width), static_cast<float>(rect.height)};
+        UpdateTextureRec(m_texture, raylibRect, pixels);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendTextureRaylib::setSmooth(bool smooth)
     {
         if (m_isSmooth == smooth)
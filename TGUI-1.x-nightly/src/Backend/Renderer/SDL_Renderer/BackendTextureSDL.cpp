@@ -138,6 +138,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool BackendTextureSDL::updatePixels(UIntRect rect, const std::uint8_t* pixels)
+    {
+        if (!m_texture)
+            return false;
+
+        TGUI_ASSERT((rect.left + rect.width <= m_imageSize.x) && (rect.top + rect.height <= m_imageSize.y), "Rect must lie inside the texture in BackendTextureSDL::updatePixels");
+
+        const SDL_Rect sdlRect{static_cast<int>(rect.left), static_cast<int>(rect.top), static_cast<int>(rect.width), static_cast<int>(rect.height)};
+        SDL_UpdateTexture(m_texture, &sdlRect, pixels, static_cast<int>(rect.width * 4));
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendTextureSDL::setSmooth(bool smooth)
     {
         if (m_isSmooth == smooth)
@@ -81,8 +81,17 @@ namespace tgui
         updateClipping(m_viewRect, m_viewport);
 
         // Draw the widgets
+        m_batchVertices.clear();
+        m_batchTexture = nullptr;
+        m_frameStatistics = {};
         root->draw(*this, {});
 
+        // Draw whatever is still in the batch
+        flushBatch();
+        m_batchTexture = nullptr;
+
+        m_lastFrameStatistics = m_frameStatistics;
+
         // Restore the old view
         m_target->setView(oldView);
     }
@@ -114,6 +123,9 @@ namespace tgui
         if (clippingRequired)
             addClippingLayer(transformedStates, {{visibleRect.left, visibleRect.top}, {visibleRect.width, visibleRect.height}});
 
+        // Sprites with a shader can't be batched, so everything that came before it has to be drawn first
+        flushBatch();
+
         std::shared_ptr<BackendTexture> texture = sprite.getTexture().getData()->backendTexture;
 
         sf::RenderStates sfStates = convertRenderStates(transformedStates, texture);
@@ -147,6 +159,10 @@ namespace tgui
         const sf::Vertex* sfmlVertices = reinterpret_cast<const sf::Vertex*>(triangleVertices.get());
         m_target->draw(sfmlVertices, indices.size(), sf::PrimitiveType::Triangles, sfStates);
 
+        ++m_frameStatistics.vertexArrays;
+        ++m_frameStatistics.drawCalls;
+        m_frameStatistics.vertices += indices.size();
+
         if (clippingRequired)
             removeClippingLayer();
     }
@@ -156,56 +172,63 @@ namespace tgui
     void BackendRenderTargetSFML::drawVertexArray(const RenderStates& states, const Vertex* vertices,
         std::size_t vertexCount, const unsigned int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture)
     {
-        // Creating an sf::Vertex costs time because its constructor can't be inlined. Since our own Vertex struct has an identical memory layout,
-        // we will create an array of our own Vertex objects and then use a reinterpret_cast to turn them into sf::Vertex.
-        static_assert(sizeof(Vertex) == sizeof(sf::Vertex), "Size of sf::Vertex has to match with tgui::Vertex for optimization to work");
+        // Triangles with a different texture can't be part of the same draw call
+        if (m_batchTexture != texture)
+        {
+            if (!m_batchVertices.empty())
+            {
+                flushBatch();
+                ++m_frameStatistics.textureFlushes;
+            }
+
+            m_batchTexture = texture;
+        }
+
+        ++m_frameStatistics.vertexArrays;
 
 #if SFML_VERSION_MAJOR < 3
         const Vector2f textureSize = texture ? Vector2f{texture->getSize()} : Vector2f{1,1};
 #endif
 
-        if (indices)
+        // The transform is applied here so that triangles with different transforms can still be drawn together.
+        // SFML can't draw indexed triangles, so the indices are expanded into separate vertices.
+        const std::size_t count = indices ? indexCount : vertexCount;
+        const std::size_t firstVertex = m_batchVertices.size();
+        m_batchVertices.resize(firstVertex + count);
+        for (std::size_t i = 0; i < count; ++i)
         {
-            auto verticesSFML = MakeUniqueForOverwrite<Vertex[]>(indexCount);
-            for (std::size_t i = 0; i < indexCount; ++i)
-            {
-#if SFML_VERSION_MAJOR >= 3
-                verticesSFML[i] = vertices[indices[i]];
-#else
-                verticesSFML[i].position.x = vertices[indices[i]].position.x;
-                verticesSFML[i].position.y = vertices[indices[i]].position.y;
-                verticesSFML[i].color.red = vertices[indices[i]].color.red;
-                verticesSFML[i].color.green = vertices[indices[i]].color.green;
-                verticesSFML[i].color.blue = vertices[indices[i]].color.blue;
-                verticesSFML[i].color.alpha = vertices[indices[i]].color.alpha;
-                verticesSFML[i].texCoords.x = vertices[indices[i]].texCoords.x * textureSize.x;
-                verticesSFML[i].texCoords.y = vertices[indices[i]].texCoords.y * textureSize.y;
-#endif
-            }
+            const Vertex& vertex = indices ? vertices[indices[i]] : vertices[i];
+            Vertex& batchVertex = m_batchVertices[firstVertex + i];
 
-            m_target->draw(reinterpret_cast<const sf::Vertex*>(verticesSFML.get()), indexCount, sf::PrimitiveType::Triangles, convertRenderStates(states, texture));
-        }
-        else // There are no indices
-        {
+            batchVertex.position = states.transform.transformPoint(vertex.position);
+            batchVertex.color = vertex.color;
 #if SFML_VERSION_MAJOR >= 3
-            m_target->draw(reinterpret_cast<const sf::Vertex*>(vertices), vertexCount, sf::PrimitiveType::Triangles, convertRenderStates(states, texture));
+            batchVertex.texCoords = vertex.texCoords;
 #else
-            auto verticesSFML = std::vector<Vertex>(vertices, vertices + vertexCount);
-            for (std::size_t i = 0; i < vertexCount; ++i)
-            {
-                verticesSFML[i].texCoords.x *= textureSize.x;
-                verticesSFML[i].texCoords.y *= textureSize.y;
-            }
-
-            m_target->draw(reinterpret_cast<const sf::Vertex*>(verticesSFML.data()), vertexCount, sf::PrimitiveType::Triangles, convertRenderStates(states, texture));
+            batchVertex.texCoords.x = vertex.texCoords.x * textureSize.x;
+            batchVertex.texCoords.y = vertex.texCoords.y * textureSize.y;
 #endif
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    const BatchStatistics& BackendRenderTargetSFML::getBatchStatistics() const
+    {
+        return m_lastFrameStatistics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendRenderTargetSFML::updateClipping(FloatRect clipRect, FloatRect clipViewport)
     {
+        // Everything that was added before the clipping changed still has to be drawn with the old view
+        if (!m_batchVertices.empty())
+        {
+            flushBatch();
+            ++m_frameStatistics.clippingFlushes;
+        }
+
         if ((clipViewport.width > 0) && (clipViewport.height > 0) && (clipRect.width > 0) && (clipRect.height > 0))
         {
             m_pixelsPerPoint = {clipViewport.width / clipRect.width, clipViewport.height / clipRect.height};
@@ -253,6 +276,28 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSFML::flushBatch()
+    {
+        if (m_batchVertices.empty())
+            return;
+
+        // Creating an sf::Vertex costs time because its constructor can't be inlined. Since our own Vertex struct has an identical memory layout,
+        // the batch consists of our own Vertex objects and a reinterpret_cast is used to turn them into sf::Vertex.
+        static_assert(sizeof(Vertex) == sizeof(sf::Vertex), "Size of sf::Vertex has to match with tgui::Vertex for optimization to work");
+
+        // The vertices were already transformed when they were added to the batch
+        m_target->draw(reinterpret_cast<const sf::Vertex*>(m_batchVertices.data()), m_batchVertices.size(),
+                       sf::PrimitiveType::Triangles, convertRenderStates({}, m_batchTexture));
+
+        ++m_frameStatistics.drawCalls;
+        m_frameStatistics.vertices += m_batchVertices.size();
+
+        // Clearing keeps the memory, so the vector stops allocating after the first few frames
+        m_batchVertices.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
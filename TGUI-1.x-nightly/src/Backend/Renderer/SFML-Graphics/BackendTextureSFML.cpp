@@ -66,6 +66,22 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool BackendTextureSFML::updatePixels(UIntRect rect, const std::uint8_t* pixels)
+    {
+        if (!m_texture)
+            return false;
+
+        TGUI_ASSERT((rect.left + rect.width <= m_imageSize.x) && (rect.top + rect.height <= m_imageSize.y), "Rect must lie inside the texture in BackendTextureSFML::updatePixels");
+#if SFML_VERSION_MAJOR >= 3
+        m_texture->update(pixels, {rect.width, rect.height}, {rect.left, rect.top});
+#else
+        m_texture->update(pixels, rect.width, rect.height, rect.left, rect.top);
+#endif
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendTextureSFML::setSmooth(bool smooth)
     {
         BackendTexture::setSmooth(smooth);
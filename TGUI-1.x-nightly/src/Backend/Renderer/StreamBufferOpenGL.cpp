@@ -0,0 +1,281 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2024 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <TGUI/Backend/Renderer/StreamBufferOpenGL.hpp>
+#include <TGUI/Backend/Renderer/OpenGL.hpp>
+
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    StreamBufferOpenGL::~StreamBufferOpenGL()
+    {
+        destroy();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void StreamBufferOpenGL::create(unsigned int target, std::size_t elementSize, std::size_t elementCount, Mode mode)
+    {
+        destroy();
+
+        m_target = target;
+        m_mode = mode;
+        m_elementSize = elementSize;
+        m_elementCount = std::max<std::size_t>(elementCount, SectionCount);
+        allocate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void* StreamBufferOpenGL::map(std::size_t elementCount, std::size_t& firstElement)
+    {
+        m_mappedBytes = elementCount * m_elementSize;
+
+        // Without a way to write to part of the buffer, the data is collected in memory and copied into a new buffer when unmapping
+        if (m_mode == Mode::Orphan)
+        {
+            if (m_orphanData.size() < m_mappedBytes)
+                m_orphanData.resize(m_mappedBytes);
+
+            firstElement = 0;
+            return m_orphanData.data();
+        }
+
+        // Make the buffer larger if the data doesn't fit in a single section. The old buffer is deleted, but OpenGL keeps it alive
+        // until the draw calls that are still using it have finished.
+        const std::size_t sectionSize = m_elementCount / SectionCount;
+        if (elementCount > sectionSize)
+        {
+            std::size_t newSectionSize = sectionSize;
+            while (newSectionSize < elementCount)
+                newSectionSize *= 2;
+
+            destroy();
+            m_elementCount = newSectionSize * SectionCount;
+            allocate();
+            ++m_reallocations;
+        }
+
+        // Start again at the beginning of the buffer when the data doesn't fit at the end
+        const std::size_t reservedCount = std::max<std::size_t>(elementCount, 1);
+        if (m_writeOffset + reservedCount > m_elementCount)
+        {
+            m_writeOffset = 0;
+            enterSection(0);
+        }
+
+        // Make sure the GPU is done with every section that the data is going to be written to
+        const std::size_t lastSection = (m_writeOffset + reservedCount - 1) / (m_elementCount / SectionCount);
+        while (m_currentSection != lastSection)
+            enterSection(m_currentSection + 1);
+
+        // The fence for these sections can only be placed once the draw calls that read the data have been issued
+        const std::size_t firstSection = m_writeOffset / (m_elementCount / SectionCount);
+        for (std::size_t section = firstSection; section <= lastSection; ++section)
+            m_sectionsWritten[section] = true;
+
+        firstElement = m_writeOffset;
+        m_writeOffset += elementCount;
+
+        if (m_mode == Mode::Persistent)
+            return static_cast<unsigned char*>(m_persistentData) + (firstElement * m_elementSize);
+
+        // There is no need for the driver to synchronize, the fences already guarantee that the GPU isn't using this range
+        void* data = nullptr;
+        TGUI_GL_CHECK(data = glMapBufferRange(m_target, static_cast<GLintptr>(firstElement * m_elementSize), static_cast<GLsizeiptr>(m_mappedBytes),
+                                              GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT));
+        return data;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void StreamBufferOpenGL::unmap()
+    {
+        if (m_mode == Mode::Orphan)
+        {
+            // Orphan the buffer so that the driver doesn't have to wait for earlier draw calls to finish
+            TGUI_GL_CHECK(glBufferData(m_target, static_cast<GLsizeiptr>(m_mappedBytes), m_orphanData.data(), GL_STREAM_DRAW));
+        }
+        else if (m_mode == Mode::MapUnsynchronized)
+        {
+            TGUI_GL_CHECK(glUnmapBuffer(m_target));
+        }
+
+        // Nothing has to happen for persistent mapping, the buffer is created with GL_MAP_COHERENT_BIT
+        m_mappedBytes = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void StreamBufferOpenGL::fence()
+    {
+        // Fences are signaled in order, so a new fence also covers the draw calls that the previous fence of a section was placed behind
+        for (std::size_t section = 0; section < SectionCount; ++section)
+        {
+            if (!m_sectionsWritten[section])
+                continue;
+
+            auto& sectionFence = m_sectionFences[section];
+            if (sectionFence)
+                TGUI_GL_CHECK(glDeleteSync(static_cast<GLsync>(sectionFence)));
+            TGUI_GL_CHECK(sectionFence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+
+            m_sectionsWritten[section] = false;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool StreamBufferOpenGL::wasRecreated()
+    {
+        const bool recreated = m_recreated;
+        m_recreated = false;
+        return recreated;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int StreamBufferOpenGL::getBuffer() const
+    {
+        return m_buffer;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void StreamBufferOpenGL::addStatistics(StreamBufferStatistics& statistics) const
+    {
+        statistics.size += (m_mode == Mode::Orphan) ? m_orphanData.size() : (m_elementCount * m_elementSize);
+        statistics.stalls += m_stalls;
+        statistics.reallocations += m_reallocations;
+        statistics.persistentlyMapped = (m_mode == Mode::Persistent);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void StreamBufferOpenGL::allocate()
+    {
+        TGUI_GL_CHECK(glGenBuffers(1, &m_buffer));
+        TGUI_GL_CHECK(glBindBuffer(m_target, m_buffer));
+
+        m_writeOffset = 0;
+        m_currentSection = 0;
+        m_sectionsWritten = {};
+        m_recreated = true;
+
+        if (m_mode == Mode::Orphan)
+            return;
+
+        const auto size = static_cast<GLsizeiptr>(m_elementCount * m_elementSize);
+
+        // glBufferStorage only exists in desktop OpenGL 4.4. The caller only requests persistent mapping when it is supported.
+#ifdef GL_MAP_PERSISTENT_BIT
+        if (m_mode == Mode::Persistent)
+        {
+            const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+            TGUI_GL_CHECK(glBufferStorage(m_target, size, nullptr, flags));
+            TGUI_GL_CHECK(m_persistentData = glMapBufferRange(m_target, 0, size, flags));
+            if (m_persistentData)
+                return;
+
+            // Mapping failed, so use a normal buffer instead. Buffers created with glBufferStorage can't be resized.
+            TGUI_GL_CHECK(glDeleteBuffers(1, &m_buffer));
+            TGUI_GL_CHECK(glGenBuffers(1, &m_buffer));
+            TGUI_GL_CHECK(glBindBuffer(m_target, m_buffer));
+        }
+#endif
+        m_mode = Mode::MapUnsynchronized;
+        TGUI_GL_CHECK(glBufferData(m_target, size, nullptr, GL_STREAM_DRAW));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void StreamBufferOpenGL::destroy()
+    {
+        for (auto& fence : m_sectionFences)
+        {
+            if (fence)
+                TGUI_GL_CHECK(glDeleteSync(static_cast<GLsync>(fence)));
+
+            fence = nullptr;
+        }
+
+        if (m_persistentData)
+        {
+            GLint oldBoundBuffer = 0;
+            TGUI_GL_CHECK(glGetIntegerv(m_target == GL_ARRAY_BUFFER ? GL_ARRAY_BUFFER_BINDING : GL_ELEMENT_ARRAY_BUFFER_BINDING, &oldBoundBuffer));
+            TGUI_GL_CHECK(glBindBuffer(m_target, m_buffer));
+            TGUI_GL_CHECK(glUnmapBuffer(m_target));
+            TGUI_GL_CHECK(glBindBuffer(m_target, static_cast<GLuint>(oldBoundBuffer)));
+            m_persistentData = nullptr;
+        }
+
+        if (m_buffer)
+        {
+            TGUI_GL_CHECK(glDeleteBuffers(1, &m_buffer));
+            m_buffer = 0;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void StreamBufferOpenGL::enterSection(std::size_t section)
+    {
+        section %= SectionCount;
+        if (section == m_currentSection)
+            return;
+
+        TGUI_ASSERT(!m_sectionsWritten[section], "fence() has to be called after drawing the data that was written to the stream buffer");
+        m_currentSection = section;
+
+        auto& fence = m_sectionFences[section];
+        if (!fence)
+            return;
+
+        // Only wait when the GPU hasn't already finished with the section
+        GLenum result = glClientWaitSync(static_cast<GLsync>(fence), 0, 0);
+        if (result == GL_TIMEOUT_EXPIRED)
+        {
+            ++m_stalls;
+            do
+            {
+                result = glClientWaitSync(static_cast<GLsync>(fence), GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+            }
+            while (result == GL_TIMEOUT_EXPIRED);
+        }
+
+        TGUI_GL_CHECK(glDeleteSync(static_cast<GLsync>(fence)));
+        fence = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -176,7 +176,10 @@ namespace tgui
         // which is why we can't just use call add(widget) for each widget.
         m_widgets.reserve(other.m_widgets.size());
         for (const auto& widget : other.m_widgets)
+        {
             m_widgets.emplace_back(widget->clone());
+            addToNameIndex(m_widgets.back().get());
+        }
 
         for (const auto& widget : m_widgets)
             widgetAdded(widget);
@@ -193,7 +196,8 @@ namespace tgui
         m_widgetWithLeftMouseDown {std::move(other.m_widgetWithLeftMouseDown)},
         m_widgetWithRightMouseDown{std::move(other.m_widgetWithRightMouseDown)},
         m_focusedWidget           {std::move(other.m_focusedWidget)},
-        m_draggingWidget          {std::move(other.m_draggingWidget)}
+        m_draggingWidget          {std::move(other.m_draggingWidget)},
+        m_widgetNameIndex         {std::move(other.m_widgetNameIndex)}
     {
         // Parent of all widgets should be set to nullptr first, in case widgets have layouts depending on each other.
         // Otherwise calling setParent on one widget could cause another widget's position to be recalculated which could
@@ -239,7 +243,10 @@ namespace tgui
             // which is why we can't just use call add(widget) for each widget.
             m_widgets.reserve(right.m_widgets.size());
             for (auto& widget : right.m_widgets)
+            {
                 m_widgets.emplace_back(widget->clone());
+                addToNameIndex(m_widgets.back().get());
+            }
 
             for (auto& widget : m_widgets)
                 widgetAdded(widget);
@@ -258,6 +265,7 @@ namespace tgui
         if (this != &right)
         {
             m_widgets                  = std::move(right.m_widgets);
+            m_widgetNameIndex          = std::move(right.m_widgetNameIndex);
             m_widgetBelowMouse         = std::move(right.m_widgetBelowMouse);
             m_widgetWithLeftMouseDown  = std::move(right.m_widgetWithLeftMouseDown);
             m_widgetWithRightMouseDown = std::move(right.m_widgetWithRightMouseDown);
@@ -310,6 +318,7 @@ namespace tgui
         if (!widgetName.empty())
             widgetPtr->setWidgetName(widgetName);
 
+        addToNameIndex(widgetPtr.get());
         widgetAdded(widgetPtr);
 
         if (widgetPtr->getAutoLayout() != AutoLayout::Manual)
@@ -321,11 +330,9 @@ namespace tgui
     Widget::Ptr Container::get(const String& widgetName) const
     {
         // First search for direct children
-        for (const auto& child : m_widgets)
-        {
-            if (child->getWidgetName() == widgetName)
-                return child;
-        }
+        Widget::Ptr directChild = getChild(widgetName);
+        if (directChild)
+            return directChild;
 
         // If no widget was found then search recursively
         for (const auto& child : m_widgets)
@@ -355,6 +362,71 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Widget::Ptr Container::getChild(const String& widgetName, bool caseSensitive) const
+    {
+        const auto it = m_widgetNameIndex.find(widgetName.toLower().toUtf32());
+        if (it == m_widgetNameIndex.end())
+            return nullptr;
+
+        const auto nameMatches = [&widgetName,caseSensitive](const Widget* widget){
+            return caseSensitive ? (widget->getWidgetName() == widgetName) : widget->getWidgetName().equalIgnoreCase(widgetName);
+        };
+
+        const auto& candidates = it->second;
+        if (candidates.size() == 1)
+        {
+            if (nameMatches(candidates[0]))
+                return candidates[0]->shared_from_this();
+            else
+                return nullptr;
+        }
+
+        // When multiple children have a similar name, the first one in the list of widgets has to be returned
+        for (const auto& child : m_widgets)
+        {
+            if (nameMatches(child.get()))
+                return child;
+        }
+
+        return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Widget::Ptr Container::getByPath(const String& path) const
+    {
+        const Container* container = this;
+        std::size_t nameStart = 0;
+        while (true)
+        {
+            const auto dotPos = path.find('.', nameStart);
+            Widget::Ptr widget = container->getChild(path.substr(nameStart, (dotPos != String::npos) ? (dotPos - nameStart) : String::npos));
+            if (!widget || (dotPos == String::npos))
+                return widget;
+
+            // The path continues, so the widget has to contain other widgets
+            if (widget->isContainer())
+                container = static_cast<const Container*>(widget.get());
+            else if (const auto* subWidgetContainer = dynamic_cast<const SubwidgetContainer*>(widget.get()))
+                container = subWidgetContainer->getContainer();
+            else
+                return nullptr;
+
+            nameStart = dotPos + 1;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<Widget::Ptr> Container::findWidgets(const String& widgetType, const String& namePrefix, bool recursive) const
+    {
+        std::vector<Widget::Ptr> widgets;
+        findWidgetsImpl(widgets, widgetType, namePrefix, recursive);
+        return widgets;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Container::remove(const Widget::Ptr& widget)
     {
         // Loop through every widget
@@ -392,6 +464,7 @@ namespace tgui
             }
 
             // Remove the widget
+            removeFromNameIndex(widget.get(), widget->getWidgetName());
             widget->setParent(nullptr);
             m_widgets.erase(m_widgets.begin() + static_cast<std::ptrdiff_t>(i));
 
@@ -421,6 +494,7 @@ namespace tgui
             widget->setParent(nullptr);
 
         m_widgets.clear();
+        m_widgetNameIndex.clear();
 
         m_widgetBelowMouse = nullptr;
         m_widgetWithLeftMouseDown = nullptr;
@@ -1361,6 +1435,10 @@ namespace tgui
 
     void Container::updateChildrenWithAutoLayout()
     {
+        // The children will be positioned when the batch update ends
+        if (isBatchUpdating())
+            return;
+
         // If all children have a manual layout then we don't need to do anything
         bool allChildrenUseManualLayout = true;
         for (const auto& child : m_widgets)
@@ -1594,6 +1672,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::batchUpdateFinished()
+    {
+        Widget::batchUpdateFinished();
+        updateChildrenWithAutoLayout();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::widgetAdded(const Widget::Ptr& widgetPtr)
     {
         if (widgetPtr->getParent())
@@ -1616,6 +1702,72 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::addToNameIndex(Widget* widget)
+    {
+        m_widgetNameIndex[widget->getWidgetName().toLower().toUtf32()].push_back(widget);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::removeFromNameIndex(Widget* widget, const String& name)
+    {
+        const auto removeFromBucket = [this,widget](decltype(m_widgetNameIndex)::iterator it){
+            auto& widgets = it->second;
+            const auto widgetIt = std::find(widgets.begin(), widgets.end(), widget);
+            if (widgetIt == widgets.end())
+                return false;
+
+            widgets.erase(widgetIt);
+            if (widgets.empty())
+                m_widgetNameIndex.erase(it);
+
+            return true;
+        };
+
+        const auto it = m_widgetNameIndex.find(name.toLower().toUtf32());
+        if ((it != m_widgetNameIndex.end()) && removeFromBucket(it))
+            return true;
+
+        // Assigning another widget to a child notifies us about the new name, but it also clears the parent pointer of the child.
+        // A name that is changed after that can't reach us, so the widget may still be stored under an older name.
+        for (auto bucketIt = m_widgetNameIndex.begin(); bucketIt != m_widgetNameIndex.end(); ++bucketIt)
+        {
+            if (removeFromBucket(bucketIt))
+                return true;
+        }
+
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::childNameChanged(Widget* widget, const String& oldName)
+    {
+        if (removeFromNameIndex(widget, oldName))
+            addToNameIndex(widget);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::findWidgetsImpl(std::vector<Widget::Ptr>& widgets, const String& widgetType, const String& namePrefix, bool recursive) const
+    {
+        for (const auto& child : m_widgets)
+        {
+            if ((widgetType.empty() || (child->getWidgetType() == widgetType)) && child->getWidgetName().starts_with(namePrefix.toUtf32()))
+                widgets.push_back(child);
+
+            if (!recursive)
+                continue;
+
+            if (child->isContainer())
+                static_cast<const Container*>(child.get())->findWidgetsImpl(widgets, widgetType, namePrefix, recursive);
+            else if (const auto* subWidgetContainer = dynamic_cast<const SubwidgetContainer*>(child.get()))
+                subWidgetContainer->getContainer()->findWidgetsImpl(widgets, widgetType, namePrefix, recursive);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::injectFormFilePath(const std::unique_ptr<DataIO::Node>& node, const String& path, std::map<String, bool>& checkedFilenames) const
     {
         for (const auto& pair : node->propertyValuePairs)
@@ -146,10 +146,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    float Font::getGlyphAdvance(char32_t codePoint, unsigned int characterSize, bool bold) const
+    {
+        if (m_backendFont)
+            return m_backendFont->getGlyphAdvance(codePoint, characterSize, bold);
+        else
+            return 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     float Font::getKerning(char32_t first, char32_t second, unsigned int characterSize, bool bold) const
     {
         if (m_backendFont)
-            return m_backendFont->getKerning(first, second, characterSize, bold);
+            return m_backendFont->getCachedKerning(first, second, characterSize, bold);
         else
             return 0;
     }
@@ -217,20 +217,29 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool writeFile(const String& filename, CharStringView stringView)
+    // Opens a file for writing, in binary mode when the data shouldn't have its line endings converted on Windows
+    TGUI_NODISCARD static FILE* openFileForWriting(const String& filename, bool binary)
     {
         // On Windows, we use _wfopen_s with MSVC, MinGW-w64 and Clang (both LLVM Clang and Clang-CL).
         // With MinGW.org based TDM-GCC, we can't use _wfopen_s so we call _wfopen if the function is defined (i.e. if __STRICT_ANSI__ is undefined).
         // If _wfopen is unavailable, we simply use fopen (and hope that the system uses UTF-8 or that filename only contains ASCII characters).
 #if defined(TGUI_SYSTEM_WINDOWS) && (defined(_MSC_VER) || defined(__MINGW64_VERSION_MAJOR) || defined(__clang__))
         FILE* file = nullptr;
-        if (_wfopen_s(&file, filename.toWideString().c_str(), L"w") != 0)
-            return false;
+        if (_wfopen_s(&file, filename.toWideString().c_str(), binary ? L"wb" : L"w") != 0)
+            return nullptr;
+        return file;
 #elif defined(TGUI_SYSTEM_WINDOWS) && !defined(__STRICT_ANSI__)
-        FILE* file = _wfopen(filename.toWideString().c_str(), L"w");
+        return _wfopen(filename.toWideString().c_str(), binary ? L"wb" : L"w");
 #else
-        FILE* file = fopen(filename.toStdString().c_str(), "w");
+        return fopen(filename.toStdString().c_str(), binary ? "wb" : "w");
 #endif
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool writeFile(const String& filename, CharStringView stringView)
+    {
+        FILE* file = openFileForWriting(filename, false);
         if (!file)
             return false;
 
@@ -241,6 +250,21 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool writeMemoryToFile(const String& filename, const std::uint8_t* data, std::size_t sizeInBytes)
+    {
+        FILE* file = openFileForWriting(filename, true);
+        if (!file)
+            return false;
+
+        const bool success = (fwrite(data, 1, sizeInBytes, file) == sizeInBytes);
+
+        // Data that is still buffered is only written when closing the file, which can fail as well
+        const bool closed = (fclose(file) == 0);
+        return success && closed;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
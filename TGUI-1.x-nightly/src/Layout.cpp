@@ -60,6 +60,46 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    TGUI_NODISCARD static Layout::Operation getBindingOperation(LayoutExpression::Property property)
+    {
+        // Properties that depend on the axis get the operation for the x axis, connectWidget switches it for the y axis
+        switch (property)
+        {
+        case LayoutExpression::Property::PosX:        return Layout::Operation::BindingPosX;
+        case LayoutExpression::Property::PosY:        return Layout::Operation::BindingPosY;
+        case LayoutExpression::Property::Left:        return Layout::Operation::BindingLeft;
+        case LayoutExpression::Property::Top:         return Layout::Operation::BindingTop;
+        case LayoutExpression::Property::Width:       return Layout::Operation::BindingWidth;
+        case LayoutExpression::Property::Height:      return Layout::Operation::BindingHeight;
+        case LayoutExpression::Property::InnerWidth:  return Layout::Operation::BindingInnerWidth;
+        case LayoutExpression::Property::InnerHeight: return Layout::Operation::BindingInnerHeight;
+        case LayoutExpression::Property::Size:        return Layout::Operation::BindingWidth;
+        case LayoutExpression::Property::InnerSize:   return Layout::Operation::BindingInnerWidth;
+        case LayoutExpression::Property::Position:    return Layout::Operation::BindingPosX;
+        }
+
+        TGUI_ASSERT(false, "All layout expression properties should have been covered already");
+        return Layout::Operation::BindingPosX;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TGUI_NODISCARD static Layout::Operation getBindingOperationForAxis(Layout::Operation operation, bool xAxis)
+    {
+        if ((operation == Layout::Operation::BindingPosX) || (operation == Layout::Operation::BindingPosY))
+            return xAxis ? Layout::Operation::BindingPosX : Layout::Operation::BindingPosY;
+        else if ((operation == Layout::Operation::BindingWidth) || (operation == Layout::Operation::BindingHeight))
+            return xAxis ? Layout::Operation::BindingWidth : Layout::Operation::BindingHeight;
+        else
+        {
+            TGUI_ASSERT((operation == Layout::Operation::BindingInnerWidth) || (operation == Layout::Operation::BindingInnerHeight),
+                        "Only bindings to the position, size or inner size can depend on the axis");
+            return xAxis ? Layout::Operation::BindingInnerWidth : Layout::Operation::BindingInnerHeight;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Layout::Layout(RelativeValue ratio) :
         Layout{Layout::Operation::Multiplies,
                std::make_unique<Layout>(ratio.getRatio()),
@@ -298,6 +338,23 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Layout::Layout(const LayoutExpression& expression)
+    {
+        // Constant expressions were already fully calculated when parsing them
+        if (expression.isConstant())
+        {
+            m_value = expression.getConstantValue();
+            return;
+        }
+
+        // The instructions are in reverse polish notation, so the last instruction is the root of the layout tree
+        std::size_t index = expression.getInstructionCount() - 1;
+        *this = createFromInstructions(expression, index);
+        TGUI_ASSERT(index == 0, "Layout expression should reduce to single result");
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Layout::Layout(Operation operation, Widget* boundWidget) :
         m_operation  {operation},
         m_boundWidget{boundWidget}
@@ -364,11 +421,14 @@ namespace tgui
         m_rightOperand   {other.m_rightOperand ? std::make_unique<Layout>(*other.m_rightOperand) : nullptr},
         m_boundWidget    {other.m_boundWidget},
         m_boundString    {other.m_boundString},
+        m_boundWidgetName{other.m_boundWidgetName},
+        m_boundByName    {other.m_boundByName},
+        m_boundAxisDependent{other.m_boundAxisDependent},
         m_connectedWidgetCallback{nullptr},
         m_callingCallbackCount{0}
     {
         // Disconnect the bound widget if a string was used, the same name may apply to a different widget now
-        if (!m_boundString.empty())
+        if (!m_boundString.empty() || m_boundByName)
             m_boundWidget = nullptr;
 
         resetPointers();
@@ -384,6 +444,9 @@ namespace tgui
         m_rightOperand   {std::move(other.m_rightOperand)},
         m_boundWidget    {other.m_boundWidget},
         m_boundString    {std::move(other.m_boundString)},
+        m_boundWidgetName{std::move(other.m_boundWidgetName)},
+        m_boundByName    {other.m_boundByName},
+        m_boundAxisDependent{other.m_boundAxisDependent},
         m_connectedWidgetCallback{std::move(other.m_connectedWidgetCallback)},
         m_callingCallbackCount{0}
     {
@@ -405,11 +468,14 @@ namespace tgui
             m_rightOperand    = other.m_rightOperand ? std::make_unique<Layout>(*other.m_rightOperand) : nullptr;
             m_boundWidget     = other.m_boundWidget;
             m_boundString     = other.m_boundString;
+            m_boundWidgetName = other.m_boundWidgetName;
+            m_boundByName     = other.m_boundByName;
+            m_boundAxisDependent = other.m_boundAxisDependent;
             m_connectedWidgetCallback = nullptr;
             m_callingCallbackCount = 0;
 
             // Disconnect the bound widget if a string was used, the same name may apply to a different widget now
-            if (!m_boundString.empty())
+            if (!m_boundString.empty() || m_boundByName)
                 m_boundWidget = nullptr;
 
             resetPointers();
@@ -433,6 +499,9 @@ namespace tgui
             m_rightOperand    = std::move(other.m_rightOperand);
             m_boundWidget     = other.m_boundWidget;
             m_boundString     = std::move(other.m_boundString);
+            m_boundWidgetName = std::move(other.m_boundWidgetName);
+            m_boundByName     = other.m_boundByName;
+            m_boundAxisDependent = other.m_boundAxisDependent;
             m_connectedWidgetCallback = std::move(other.m_connectedWidgetCallback);
             m_callingCallbackCount = 0;
 
@@ -524,6 +593,33 @@ namespace tgui
             if (m_boundString == U"&.innersize")
                 return U"100%";
 
+            // Bindings from a layout expression are written in the same way as in the string that the expression was parsed from
+            if (m_boundByName)
+            {
+                String propertyName;
+                switch (m_operation)
+                {
+                case Operation::BindingPosX:        propertyName = m_boundAxisDependent ? U"position" : U"x";           break;
+                case Operation::BindingPosY:        propertyName = m_boundAxisDependent ? U"position" : U"y";           break;
+                case Operation::BindingLeft:        propertyName = U"left";                                             break;
+                case Operation::BindingTop:         propertyName = U"top";                                              break;
+                case Operation::BindingWidth:       propertyName = m_boundAxisDependent ? U"size" : U"width";           break;
+                case Operation::BindingHeight:      propertyName = m_boundAxisDependent ? U"size" : U"height";          break;
+                case Operation::BindingInnerWidth:  propertyName = m_boundAxisDependent ? U"innersize" : U"innerwidth";  break;
+                case Operation::BindingInnerHeight: propertyName = m_boundAxisDependent ? U"innersize" : U"innerheight"; break;
+                default:
+                    TGUI_ASSERT(false, "Layout bound by name should have an operation that involves the widget");
+                    break;
+                }
+
+                if (m_boundWidgetName.empty())
+                    return propertyName;
+                else if ((m_boundWidgetName == U"&") && (propertyName == U"innersize"))
+                    return U"100%";
+                else
+                    return m_boundWidgetName + U"." + propertyName;
+            }
+
             // Hopefully the expression is stored in the bound string, otherwise (i.e. when bind functions were used) it is infeasible to turn it into a string
             if (!m_boundString.empty())
                 return m_boundString;
@@ -656,6 +752,8 @@ namespace tgui
 
         if (!m_boundString.empty())
             m_operation = Operation::BindingString;
+        else if (m_boundByName)
+            return; // Keep the value until the layout is connected again and a widget with the name is found
         else
         {
             m_value = 0;
@@ -773,6 +871,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Widget* Layout::getBoundWidget() const
+    {
+        return m_boundWidget;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Layout::parseBindingStringRecursive(Widget* widget, bool xAxis)
     {
         if (m_leftOperand)
@@ -786,6 +891,8 @@ namespace tgui
         // Parse the string binding even when the referred widget was already found. The widget may be added to a different parent
         if (!m_boundString.empty())
             parseBindingString(m_boundString, widget, xAxis);
+        else if (m_boundByName)
+            bindWidgetByName(widget, xAxis);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -873,23 +980,17 @@ namespace tgui
                     Container* container = dynamic_cast<Container*>(widget);
                     if (container != nullptr)
                     {
-                        const auto& widgets = container->getWidgets();
-                        for (const auto& childWidget : widgets)
-                        {
-                            if (childWidget->getWidgetName().equalIgnoreCase(widgetName))
-                                return parseBindingString(expression.substr(dotPos+1), childWidget.get(), xAxis);
-                        }
+                        const auto childWidget = container->getChild(widgetName, false);
+                        if (childWidget)
+                            return parseBindingString(expression.substr(dotPos+1), childWidget.get(), xAxis);
                     }
 
                     // If the widget has a parent, look for a sibling
                     if (widget->getParent())
                     {
-                        const auto& widgets = widget->getParent()->getWidgets();
-                        for (const auto& siblingWidget : widgets)
-                        {
-                            if (siblingWidget->getWidgetName().equalIgnoreCase(widgetName))
-                                return parseBindingString(expression.substr(dotPos+1), siblingWidget.get(), xAxis);
-                        }
+                        const auto siblingWidget = widget->getParent()->getChild(widgetName, false);
+                        if (siblingWidget)
+                            return parseBindingString(expression.substr(dotPos+1), siblingWidget.get(), xAxis);
                     }
                     else // If there is no parent yet then patiently wait until the widget is added to its parent
                         return;
@@ -905,6 +1006,120 @@ namespace tgui
         recalculateValue();
     }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::bindWidgetByName(Widget* widget, bool xAxis)
+    {
+        // The widget is searched for in the same way as in parseBindingString, each part of the name is relative to the previous one
+        Widget* boundWidget = widget;
+        std::size_t nameStart = 0;
+        while (nameStart < m_boundWidgetName.length())
+        {
+            auto nameEnd = m_boundWidgetName.find('.', nameStart);
+            if (nameEnd == String::npos)
+                nameEnd = m_boundWidgetName.length();
+
+            const String widgetName = m_boundWidgetName.substr(nameStart, nameEnd - nameStart);
+            nameStart = nameEnd + 1;
+
+            // If there is no parent yet then patiently wait until the widget is added to its parent
+            if (widgetName == U"parent" || widgetName == U"&")
+            {
+                boundWidget = boundWidget->getParent();
+                if (!boundWidget)
+                    return;
+
+                continue;
+            }
+
+            // If the widget is a container, search in its children first
+            Widget* foundWidget = nullptr;
+            if (const auto* container = dynamic_cast<Container*>(boundWidget))
+                foundWidget = container->getChild(widgetName, false).get();
+
+            // If the widget has a parent, look for a sibling
+            if (!foundWidget)
+            {
+                if (!boundWidget->getParent())
+                    return;
+
+                foundWidget = boundWidget->getParent()->getChild(widgetName, false).get();
+            }
+
+            if (!foundWidget)
+            {
+                TGUI_PRINT_WARNING("failed to find bound widget '" << m_boundWidgetName << "' in layout expression.");
+                return;
+            }
+
+            boundWidget = foundWidget;
+        }
+
+        // The widget that was bound before may no longer be the one with this name
+        unbindLayout();
+
+        if (m_boundAxisDependent)
+            m_operation = getBindingOperationForAxis(m_operation, xAxis);
+
+        m_boundWidget = boundWidget;
+        resetPointers();
+        recalculateValue();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Layout Layout::createFromInstructions(const LayoutExpression& expression, std::size_t& index)
+    {
+        const auto& instruction = expression.getInstruction(index);
+        switch (instruction.opcode)
+        {
+        case LayoutExpression::Opcode::Value:
+            return Layout{instruction.value};
+
+        case LayoutExpression::Opcode::Binding:
+        {
+            // The widget can't be searched for yet, connectWidget will look it up by name
+            Layout binding;
+            binding.m_operation = getBindingOperation(instruction.property);
+            binding.m_boundWidgetName = expression.getBindingName(instruction);
+            binding.m_boundByName = true;
+            binding.m_boundAxisDependent = (instruction.property == LayoutExpression::Property::Size)
+                                        || (instruction.property == LayoutExpression::Property::InnerSize)
+                                        || (instruction.property == LayoutExpression::Property::Position);
+            return binding;
+        }
+
+        case LayoutExpression::Opcode::Negate:
+        {
+            TGUI_ASSERT(index >= 1, "Operand missing in layout expression");
+            auto operand = std::make_unique<Layout>(createFromInstructions(expression, --index));
+            return Layout{Operation::Minus, std::make_unique<Layout>(), std::move(operand)};
+        }
+
+        default: // Operation on two operands
+        {
+            Operation operation = Operation::Plus;
+            if (instruction.opcode == LayoutExpression::Opcode::Minus)
+                operation = Operation::Minus;
+            else if (instruction.opcode == LayoutExpression::Opcode::Multiplies)
+                operation = Operation::Multiplies;
+            else if (instruction.opcode == LayoutExpression::Opcode::Divides)
+                operation = Operation::Divides;
+            else if (instruction.opcode == LayoutExpression::Opcode::Minimum)
+                operation = Operation::Minimum;
+            else if (instruction.opcode == LayoutExpression::Opcode::Maximum)
+                operation = Operation::Maximum;
+
+            // The right operand is stored directly in front of the operation, the left operand is in front of the right one
+            TGUI_ASSERT(index >= 2, "Operand missing in layout expression");
+            auto rightOperand = std::make_unique<Layout>(createFromInstructions(expression, --index));
+            TGUI_ASSERT(index >= 1, "Operand missing in layout expression");
+            auto leftOperand = std::make_unique<Layout>(createFromInstructions(expression, --index));
+            return Layout{operation, std::move(leftOperand), std::move(rightOperand)};
+        }
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -285,28 +285,7 @@ namespace tgui
             return 0.0f;
 
         const bool bold = (textStyle & TextStyle::Bold) != 0;
-
-        float width = 0.0f;
-        char32_t prevChar = 0;
-        for (const char32_t curChar : text)
-        {
-            float charWidth;
-            if (curChar == '\n')
-                break;
-            else if (curChar == U'\r')
-                continue; // Skip carriage return characters which aren't rendered (we only use line feed characters to indicate a new line)
-            else if (curChar == '\t')
-                charWidth = font.getGlyph(' ', characterSize, bold).advance * 4.0f;
-            else
-                charWidth = font.getGlyph(curChar, characterSize, bold).advance;
-
-            const float kerning = font.getKerning(prevChar, curChar, characterSize, bold);
-
-            width += charWidth + kerning;
-            prevChar = curChar;
-        }
-
-        return width;
+        return font.getBackendFont()->getLineWidth(text, characterSize, bold);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -380,9 +359,9 @@ namespace tgui
                     continue;
                 }
                 else if (curChar == U'\t')
-                    charWidth = font.getGlyph(U' ', textSize, bold).advance * 4;
+                    charWidth = font.getGlyphAdvance(U' ', textSize, bold) * 4;
                 else
-                    charWidth = font.getGlyph(curChar, textSize, bold).advance;
+                    charWidth = font.getGlyphAdvance(curChar, textSize, bold);
 
                 const float kerning = font.getKerning(prevChar, curChar, textSize, bold);
                 const bool charIsWhitespace = (curChar == U' ') || (curChar == U'\t');
@@ -495,9 +474,9 @@ namespace tgui
                         const bool boldStyle = ((inputPiece.style & TextStyle::Bold) != 0);
                         TGUI_ASSERT(curChar != U'\n' && curChar != U'\r', "Newline characters must be removed before calling Text::wordWrap with blueprints")
                         if (curChar == U'\t')
-                            charWidth = font.getGlyph(U' ', inputPiece.characterSize, boldStyle).advance * 4;
+                            charWidth = font.getGlyphAdvance(U' ', inputPiece.characterSize, boldStyle) * 4;
                         else
-                            charWidth = font.getGlyph(curChar, inputPiece.characterSize, boldStyle).advance;
+                            charWidth = font.getGlyphAdvance(curChar, inputPiece.characterSize, boldStyle);
 
                         if (pieceCharIndex > 0)
                             kerning = font.getKerning(prevChar, curChar, inputPiece.characterSize, boldStyle);
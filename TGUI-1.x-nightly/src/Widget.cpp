@@ -38,6 +38,34 @@ namespace tgui
 
     namespace
     {
+        // Widgets of which a layout changed and that still have to be updated, in the order in which they were marked
+        std::vector<Widget*> pendingLayoutWidgets;
+
+        // Widgets that are being updated in the layout pass, each widget waits for the widgets after it
+        std::vector<Widget*> layoutUpdateStack;
+
+        // The layout pass is postponed while layouts are still propagating a change
+        unsigned int layoutPassDeferCount = 0;
+        bool layoutPassRunning = false;
+        std::uint64_t layoutPassId = 0;
+        std::uint64_t layoutUpdateCount = 0;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void addBoundWidgets(const Layout* layout, std::vector<Widget*>& widgets)
+        {
+            if (!layout)
+                return;
+
+            if (layout->getBoundWidget())
+                widgets.push_back(layout->getBoundWidget());
+
+            addBoundWidgets(layout->getLeftOperand(), widgets);
+            addBoundWidgets(layout->getRightOperand(), widgets);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
         void finishExistingConflictingAnimations(std::vector<std::unique_ptr<priv::Animation>>& animations, ShowEffectType type)
         {
             // Only one animation of each type can be played at the same type. If e.g. a fade animation was already in progress
@@ -154,6 +182,13 @@ namespace tgui
         for (auto& layout : m_boundSizeLayouts)
             layout->unbindWidget();
 
+        // Make sure that a pending layout update doesn't access the widget anymore
+        if (m_layoutUpdateQueued || layoutPassRunning)
+        {
+            std::replace(pendingLayoutWidgets.begin(), pendingLayoutWidgets.end(), this, static_cast<Widget*>(nullptr));
+            std::replace(layoutUpdateStack.begin(), layoutUpdateStack.end(), this, static_cast<Widget*>(nullptr));
+        }
+
         SignalManager::getSignalManager()->remove(this);
     }
 
@@ -190,10 +225,10 @@ namespace tgui
         m_transparentTextureCached     {other.m_transparentTextureCached},
         m_textSizeCached               {other.m_textSizeCached}
     {
-        m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
-        m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
-        m_size.x.connectWidget(this, true, [this]{ setSize(getSizeLayout()); });
-        m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
+        m_position.x.connectWidget(this, true, [this]{ markLayoutDirty(false); });
+        m_position.y.connectWidget(this, false, [this]{ markLayoutDirty(false); });
+        m_size.x.connectWidget(this, true, [this]{ markLayoutDirty(true); });
+        m_size.y.connectWidget(this, false, [this]{ markLayoutDirty(true); });
 
         m_renderer->subscribe(this);
     }
@@ -248,10 +283,10 @@ namespace tgui
         m_transparentTextureCached     {std::move(other.m_transparentTextureCached)},
         m_textSizeCached               {std::move(other.m_textSizeCached)}
     {
-        m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
-        m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
-        m_size.x.connectWidget(this, true, [this]{ setSize(getSizeLayout()); });
-        m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
+        m_position.x.connectWidget(this, true, [this]{ markLayoutDirty(false); });
+        m_position.y.connectWidget(this, false, [this]{ markLayoutDirty(false); });
+        m_size.x.connectWidget(this, true, [this]{ markLayoutDirty(true); });
+        m_size.y.connectWidget(this, false, [this]{ markLayoutDirty(true); });
 
         other.m_renderer->unsubscribe(&other);
         m_renderer->subscribe(this);
@@ -268,6 +303,10 @@ namespace tgui
     {
         if (this != &other)
         {
+            // The widget remains in its container, which has to be told about the new name to keep finding the widget by name
+            Container* const parent = m_parent;
+            const String oldName = m_name;
+
             m_renderer->unsubscribe(this);
 
             enable_shared_from_this::operator=(other);
@@ -322,12 +361,15 @@ namespace tgui
             m_transparentTextureCached = other.m_transparentTextureCached;
             m_textSizeCached       = other.m_textSizeCached;
 
-            m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
-            m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
-            m_size.x.connectWidget(this, true, [this]{ setSize(getSizeLayout()); });
-            m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
+            m_position.x.connectWidget(this, true, [this]{ markLayoutDirty(false); });
+            m_position.y.connectWidget(this, false, [this]{ markLayoutDirty(false); });
+            m_size.x.connectWidget(this, true, [this]{ markLayoutDirty(true); });
+            m_size.y.connectWidget(this, false, [this]{ markLayoutDirty(true); });
 
             m_renderer->subscribe(this);
+
+            if (parent && (m_name != oldName))
+                parent->childNameChanged(this, oldName);
         }
 
         return *this;
@@ -339,6 +381,11 @@ namespace tgui
     {
         if (this != &other)
         {
+            // The widget remains in its container, which has to be told about the new name to keep finding the widget by name
+            Container* const parent = m_parent;
+            const String oldName = m_name;
+            const String otherOldName = other.m_name;
+
             m_renderer->unsubscribe(this);
             other.m_renderer->unsubscribe(&other);
 
@@ -390,13 +437,20 @@ namespace tgui
             m_transparentTextureCached = std::move(other.m_transparentTextureCached);
             m_textSizeCached       = std::move(other.m_textSizeCached);
 
-            m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
-            m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
-            m_size.x.connectWidget(this, true, [this]{ setSize(getSizeLayout()); });
-            m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
+            m_position.x.connectWidget(this, true, [this]{ markLayoutDirty(false); });
+            m_position.y.connectWidget(this, false, [this]{ markLayoutDirty(false); });
+            m_size.x.connectWidget(this, true, [this]{ markLayoutDirty(true); });
+            m_size.y.connectWidget(this, false, [this]{ markLayoutDirty(true); });
 
             m_renderer->subscribe(this);
 
+            if (parent && (m_name != oldName))
+                parent->childNameChanged(this, oldName);
+
+            // The name was moved out of the other widget, which could also still be inside a container
+            if (other.m_parent && (other.m_name != otherOldName))
+                other.m_parent->childNameChanged(&other, otherOldName);
+
             if (other.m_parent)
                 SignalManager::getSignalManager()->remove(&other);
 
@@ -574,8 +628,8 @@ namespace tgui
     void Widget::setPosition(const Layout2d& position)
     {
         m_position = position;
-        m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
-        m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
+        m_position.x.connectWidget(this, true, [this]{ markLayoutDirty(false); });
+        m_position.y.connectWidget(this, false, [this]{ markLayoutDirty(false); });
 
         if (getPosition() != m_prevPosition)
         {
@@ -594,8 +648,8 @@ namespace tgui
     void Widget::setSize(const Layout2d& size)
     {
         m_size = size;
-        m_size.x.connectWidget(this, true, [this]{ setSize(getSizeLayout()); });
-        m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
+        m_size.x.connectWidget(this, true, [this]{ markLayoutDirty(true); });
+        m_size.y.connectWidget(this, false, [this]{ markLayoutDirty(true); });
 
         if (getSize() != m_prevSize)
         {
@@ -1166,9 +1220,12 @@ namespace tgui
     {
         if (m_name != name)
         {
+            const String oldName = m_name;
             m_name = name;
             if (m_parent)
             {
+                m_parent->childNameChanged(this, oldName);
+
                 SignalManager::getSignalManager()->remove(this);
                 SignalManager::getSignalManager()->add(shared_from_this());
             }
@@ -1341,10 +1398,10 @@ namespace tgui
         // Give the layouts another chance to find widgets to which it refers
         if (parent)
         {
-            m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
-            m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
-            m_size.x.connectWidget(this, true, [this]{ setSize(getSizeLayout()); });
-            m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
+            m_position.x.connectWidget(this, true, [this]{ markLayoutDirty(false); });
+            m_position.y.connectWidget(this, false, [this]{ markLayoutDirty(false); });
+            m_size.x.connectWidget(this, true, [this]{ markLayoutDirty(true); });
+            m_size.y.connectWidget(this, false, [this]{ markLayoutDirty(true); });
         }
     }
 
@@ -1375,6 +1432,46 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Widget::beginBatchUpdate()
+    {
+        ++m_batchUpdateDepth;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::endBatchUpdate()
+    {
+        TGUI_ASSERT(m_batchUpdateDepth > 0, "endBatchUpdate called without matching beginBatchUpdate");
+        if (m_batchUpdateDepth == 0)
+            return;
+
+        --m_batchUpdateDepth;
+        if (m_batchUpdateDepth == 0)
+            batchUpdateFinished();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Widget::isBatchUpdating() const
+    {
+        return m_batchUpdateDepth > 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::uint64_t Widget::getLayoutUpdateCount()
+    {
+        return layoutUpdateCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::batchUpdateFinished()
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Widget::leftMousePressed(Vector2f)
     {
         m_mouseDown = true;
@@ -1890,12 +1987,18 @@ namespace tgui
 
         // Because updating one layout could result in another layout being destroyed, we must also check that
         // the layout still exists in the latest list before calling it. The first layout doesn't need this check.
+        ++layoutPassDeferCount;
         (*layoutIt)->recalculateValue();
         while (++layoutIt != boundPositionLayouts.end())
         {
             if (m_boundPositionLayouts.find(*layoutIt) != m_boundPositionLayouts.end())
                 (*layoutIt)->recalculateValue();
         }
+        --layoutPassDeferCount;
+
+        // Once the change has reached all layouts that depend on it, update the widgets that were affected
+        if ((layoutPassDeferCount == 0) && !layoutPassRunning && !pendingLayoutWidgets.empty())
+            updateDirtyLayouts();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1912,12 +2015,177 @@ namespace tgui
 
         // Because updating one layout could result in another layout being destroyed, we must also check that
         // the layout still exists in the latest list before calling it. The first layout doesn't need this check.
+        ++layoutPassDeferCount;
         (*layoutIt)->recalculateValue();
         while (++layoutIt != boundSizeLayouts.end())
         {
             if (m_boundSizeLayouts.find(*layoutIt) != m_boundSizeLayouts.end())
                 (*layoutIt)->recalculateValue();
         }
+        --layoutPassDeferCount;
+
+        // Once the change has reached all layouts that depend on it, update the widgets that were affected
+        if ((layoutPassDeferCount == 0) && !layoutPassRunning && !pendingLayoutWidgets.empty())
+            updateDirtyLayouts();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::markLayoutDirty(bool sizeLayout)
+    {
+        if (sizeLayout)
+            m_sizeLayoutDirty = true;
+        else
+            m_positionLayoutDirty = true;
+
+        if (!m_layoutUpdateQueued)
+        {
+            m_layoutUpdateQueued = true;
+            pendingLayoutWidgets.push_back(this);
+        }
+
+        // If the layout didn't change because of another widget (e.g. a layout was assigned directly) then update immediately
+        if ((layoutPassDeferCount == 0) && !layoutPassRunning)
+            updateDirtyLayouts();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::updateDirtyLayouts()
+    {
+        layoutPassRunning = true;
+        ++layoutPassId;
+
+        // Updating a widget can mark widgets that depend on it, which are added to the end of the list.
+        // The list can grow while iterating, so it is accessed by index.
+        for (std::size_t i = 0; i < pendingLayoutWidgets.size(); ++i)
+        {
+            // The widget could have been destroyed after it was marked, or it could already have been updated as the dependency
+            // of another widget
+            Widget* widget = pendingLayoutWidgets[i];
+            if (widget && widget->m_layoutUpdateQueued)
+                widget->updateDirtyLayout();
+        }
+
+        pendingLayoutWidgets.clear();
+        layoutPassRunning = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::updateDirtyLayout()
+    {
+        if (m_layoutPassId != layoutPassId)
+        {
+            m_layoutPassId = layoutPassId;
+            m_layoutUpdatesInPass = 0;
+            m_layoutCycleDetected = false;
+        }
+
+        const std::size_t stackIndex = layoutUpdateStack.size();
+        layoutUpdateStack.push_back(this);
+        m_layoutUpdateInProgress = true;
+
+        // The widgets on which this widget depends are visited first (depth-first), even when they weren't marked themselves,
+        // because they might still be marked by a change further up the chain. This way the widget is only updated once all
+        // values that it uses are final. The dependencies are looked up again after every visit, because updating a widget
+        // could destroy other widgets.
+        std::vector<Widget*> dependencies;
+        while (true)
+        {
+            dependencies.clear();
+            addBoundWidgets(&m_size.x, dependencies);
+            addBoundWidgets(&m_size.y, dependencies);
+            addBoundWidgets(&m_position.x, dependencies);
+            addBoundWidgets(&m_position.y, dependencies);
+
+            Widget* nextDependency = nullptr;
+            for (Widget* dependency : dependencies)
+            {
+                // A position that depends on the own size is handled by updating the size before the position
+                if (dependency == this)
+                    continue;
+
+                // If the dependency is still waiting for this widget then the layouts depend on each other.
+                // All widgets on the stack between the dependency and this widget are part of the cycle.
+                if (dependency->m_layoutUpdateInProgress)
+                {
+                    if (!dependency->m_layoutCycleDetected)
+                    {
+                        TGUI_PRINT_WARNING("Dependency cycle detected in layout!");
+
+                        const auto cycleIt = std::find(layoutUpdateStack.begin(), layoutUpdateStack.end(), dependency);
+                        for (auto it = cycleIt; it != layoutUpdateStack.end(); ++it)
+                        {
+                            if (*it)
+                                (*it)->m_layoutCycleDetected = true;
+                        }
+                    }
+                    continue;
+                }
+
+                if ((dependency->m_layoutPassId != layoutPassId) || dependency->m_layoutUpdateQueued)
+                {
+                    nextDependency = dependency;
+                    break;
+                }
+            }
+
+            if (!nextDependency)
+                break;
+
+            nextDependency->updateDirtyLayout();
+            if (!layoutUpdateStack[stackIndex]) // This widget was destroyed while updating the dependency
+            {
+                layoutUpdateStack.pop_back();
+                return;
+            }
+        }
+
+        m_layoutUpdateQueued = false;
+        if (m_sizeLayoutDirty || m_positionLayoutDirty)
+        {
+            // Widgets in a cycle would keep changing each other, so they are only updated once per pass. Changes that don't pass
+            // through layouts (e.g. a container that resizes its children) could also cause a loop, which is stopped here as well.
+            if ((m_layoutCycleDetected && (m_layoutUpdatesInPass > 0)) || (m_layoutUpdatesInPass >= 10))
+            {
+                if (!m_layoutCycleDetected)
+                    TGUI_PRINT_WARNING("Dependency cycle detected in layout!");
+
+                m_sizeLayoutDirty = false;
+                m_positionLayoutDirty = false;
+            }
+            else
+            {
+                ++m_layoutUpdatesInPass;
+
+                if (m_sizeLayoutDirty)
+                {
+                    m_sizeLayoutDirty = false;
+                    ++layoutUpdateCount;
+                    setSize(getSizeLayout());
+                }
+
+                // The size update could have destroyed the widget, in which case its entry was cleared
+                if (!layoutUpdateStack[stackIndex])
+                {
+                    layoutUpdateStack.pop_back();
+                    return;
+                }
+
+                if (m_positionLayoutDirty)
+                {
+                    m_positionLayoutDirty = false;
+                    ++layoutUpdateCount;
+                    setPosition(getPositionLayout());
+                }
+            }
+        }
+
+        if (layoutUpdateStack[stackIndex])
+            m_layoutUpdateInProgress = false;
+
+        layoutUpdateStack.pop_back();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1928,6 +2196,22 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BatchUpdate::BatchUpdate(Widget::Ptr widget) :
+        m_widget{std::move(widget)}
+    {
+        TGUI_ASSERT(m_widget != nullptr, "BatchUpdate requires a widget");
+        m_widget->beginBatchUpdate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BatchUpdate::~BatchUpdate()
+    {
+        m_widget->endBatchUpdate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
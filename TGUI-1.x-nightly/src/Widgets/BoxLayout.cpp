@@ -89,7 +89,8 @@ namespace tgui
         else // Just add the widget to the back
             Group::add(widget, widgetName);
 
-        updateWidgets();
+        if (!isBatchUpdating())
+            updateWidgets();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -114,7 +115,8 @@ namespace tgui
 
         Group::remove(m_widgets[index]);
 
-        updateWidgets();
+        if (!isBatchUpdating())
+            updateWidgets();
         return true;
     }
 
@@ -133,7 +135,7 @@ namespace tgui
     bool BoxLayout::setWidgetIndex(const Widget::Ptr& widget, std::size_t index)
     {
         const auto widgetIndexChanged = Group::setWidgetIndex(widget, index);
-        if (widgetIndexChanged)
+        if (widgetIndexChanged && !isBatchUpdating())
             updateWidgets();
         return widgetIndexChanged;
     }
@@ -160,6 +162,14 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BoxLayout::batchUpdateFinished()
+    {
+        Group::batchUpdateFinished();
+        updateWidgets();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -121,7 +121,8 @@ namespace tgui
             return false;
 
         m_ratios[index] = ratio;
-        updateWidgets();
+        if (!isBatchUpdating())
+            updateWidgets();
         return true;
     }
 
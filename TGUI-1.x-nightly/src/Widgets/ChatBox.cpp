@@ -125,32 +125,56 @@ namespace tgui
 
     void ChatBox::addLine(const String& text, Color color, TextStyles style)
     {
-        // Remove the oldest line if you exceed the maximum
-        if ((m_maxLines > 0) && (m_maxLines == m_lines.size()))
-        {
-            if (m_newLinesBelowOthers)
-                removeLine(0);
-            else
-                removeLine(m_maxLines-1);
-        }
+        insertLine(text, color, style);
+        updateScrollbarMaximum();
+    }
 
-        Line line;
-        line.string = text;
-        line.text.setColor(color);
-        line.text.setStyle(style);
-        line.text.setOpacity(m_opacityCached);
-        line.text.setCharacterSize(m_textSizeCached);
-        line.text.setString(text);
-        line.text.setFont(m_fontCached);
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        recalculateLineText(line);
+    void ChatBox::addLines(const std::vector<String>& lines)
+    {
+        addLines(lines, m_textColor, m_textStyle);
+    }
 
-        if (m_newLinesBelowOthers)
-            m_lines.push_back(std::move(line));
-        else
-            m_lines.push_front(std::move(line));
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        recalculateFullTextHeight();
+    void ChatBox::addLines(const std::vector<String>& lines, Color color)
+    {
+        addLines(lines, color, m_textStyle);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::addLines(const std::vector<String>& lines, Color color, TextStyles style)
+    {
+        // Only the newest lines remain when there are more lines than the line limit, the others don't have to be word-wrapped
+        std::size_t firstLine = 0;
+        if ((m_maxLines > 0) && (lines.size() > m_maxLines))
+            firstLine = lines.size() - m_maxLines;
+
+        for (std::size_t i = firstLine; i < lines.size(); ++i)
+            insertLine(lines[i], color, style);
+
+        updateScrollbarMaximum();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::queueLine(String text, Color color, TextStyles style)
+    {
+        const std::size_t maxLines = m_lineQueue.maxLines.load();
+
+        const std::lock_guard<std::mutex> lock(m_lineQueue.mutex);
+
+        // The oldest lines would be dropped when the queue is emptied anyway, so they are already removed here. This keeps the
+        // queue from growing without bounds while the chat box is hidden, as updateTime isn't called for hidden widgets.
+        if (maxLines > 0)
+        {
+            while (m_lineQueue.lines.size() >= maxLines)
+                m_lineQueue.lines.pop_front();
+        }
+
+        m_lineQueue.lines.push_back({std::move(text), color, style});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -171,7 +195,7 @@ namespace tgui
     {
         if (lineIndex < m_lines.size())
         {
-            return m_lines[lineIndex].text.getColor();
+            return m_lines[lineIndex].color;
         }
         else // Index too high
             return m_textColor;
@@ -182,7 +206,7 @@ namespace tgui
     TextStyles ChatBox::getLineTextStyle(std::size_t lineIndex) const
     {
         if (lineIndex < m_lines.size())
-            return m_lines[lineIndex].text.getStyle();
+            return m_lines[lineIndex].style;
         else // Index too high
             return m_textStyle;
     }
@@ -193,9 +217,10 @@ namespace tgui
     {
         if (lineIndex < m_lines.size())
         {
+            m_fullTextHeight -= m_lines[lineIndex].height;
             m_lines.erase(m_lines.begin() + static_cast<std::ptrdiff_t>(lineIndex));
 
-            recalculateFullTextHeight();
+            updateScrollbarMaximum();
             return true;
         }
         else // Index too high
@@ -223,6 +248,7 @@ namespace tgui
     void ChatBox::setLineLimit(std::size_t maxLines)
     {
         m_maxLines = maxLines;
+        m_lineQueue.maxLines = maxLines;
 
         // Remove the oldest lines if there are too many lines
         if ((m_maxLines > 0) && (m_maxLines < m_lines.size()))
@@ -248,10 +274,6 @@ namespace tgui
     void ChatBox::updateTextSize()
     {
         m_scrollbar->setScrollAmount(m_textSizeCached);
-
-        for (auto& line : m_lines)
-            line.text.setCharacterSize(m_textSizeCached);
-
         recalculateAllLines();
     }
 
@@ -411,15 +433,40 @@ namespace tgui
 
     void ChatBox::recalculateLineText(Line& line)
     {
-        line.text.setString("");
+        const String wrappedString = getWrappedLineString(line);
+        line.height = getTextHeight(static_cast<std::size_t>(std::count(wrappedString.begin(), wrappedString.end(), U'\n')) + 1);
+        line.wrapped = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::estimateLineHeight(Line& line)
+    {
+        // Word-wrapping can only add lines, so this is the lowest height that the line can have
+        line.height = getTextHeight(static_cast<std::size_t>(std::count(line.string.begin(), line.string.end(), U'\n')) + 1);
+        line.wrapped = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float ChatBox::getTextHeight(std::size_t nrLines) const
+    {
+        // This is the same height as the text would have when it was created, without needing to build its vertices
+        const float lineSpacing = m_fontCached.getLineSpacing(m_textSizeCached);
+        return std::max(m_fontCached.getFontHeight(m_textSizeCached), lineSpacing) + static_cast<float>(nrLines - 1) * lineSpacing;
+    }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    String ChatBox::getWrappedLineString(const Line& line) const
+    {
         // Find the maximum width of one line
         const float scrollbarWidth = m_scrollbar->isShown() ? m_scrollbar->getSize().x : 0;
         const float maxWidth = getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight() - scrollbarWidth;
         if (maxWidth < 0)
-            return;
+            return "";
 
-        line.text.setString(Text::wordWrap(maxWidth, line.string, m_fontCached, line.text.getCharacterSize(), false));
+        return Text::wordWrap(maxWidth, line.string, m_fontCached, m_textSizeCached, false);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -427,7 +474,11 @@ namespace tgui
     void ChatBox::recalculateAllLines()
     {
         for (auto& line : m_lines)
-            recalculateLineText(line);
+            estimateLineHeight(line);
+
+        // The texts that were already created have the wrong font, size or wrapping now
+        for (auto& visibleLine : m_visibleLines)
+            visibleLine.lineId = 0;
 
         recalculateFullTextHeight();
     }
@@ -438,7 +489,20 @@ namespace tgui
     {
         m_fullTextHeight = 0;
         for (const auto& line : m_lines)
-            m_fullTextHeight += line.text.getSize().y;
+            m_fullTextHeight += line.height;
+
+        updateScrollbarMaximum();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::updateScrollbarMaximum()
+    {
+        // Prevent rounding errors of adding and subtracting line heights from adding up
+        if (m_lines.empty())
+            m_fullTextHeight = 0;
+
+        m_visibleLinesOutdated = true;
 
         // Update the maximum of the scrollbar
         const unsigned int oldMaximum = m_scrollbar->getMaximum();
@@ -457,6 +521,40 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ChatBox::insertLine(const String& text, Color color, TextStyles style)
+    {
+        // Remove the oldest line if you exceed the maximum
+        if ((m_maxLines > 0) && (m_maxLines == m_lines.size()))
+        {
+            if (m_newLinesBelowOthers)
+            {
+                m_fullTextHeight -= m_lines.front().height;
+                m_lines.pop_front();
+            }
+            else
+            {
+                m_fullTextHeight -= m_lines.back().height;
+                m_lines.pop_back();
+            }
+        }
+
+        Line line;
+        line.string = text;
+        line.color = color;
+        line.style = style;
+        line.id = m_nextLineId++;
+
+        estimateLineHeight(line);
+        m_fullTextHeight += line.height;
+
+        if (m_newLinesBelowOthers)
+            m_lines.push_back(std::move(line));
+        else
+            m_lines.push_front(std::move(line));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ChatBox::rendererChanged(const String& property)
     {
         if (property == U"Borders")
@@ -505,16 +603,12 @@ namespace tgui
             m_spriteBackground.setOpacity(m_opacityCached);
             m_scrollbar->setInheritedOpacity(m_opacityCached);
 
-            for (auto& line : m_lines)
-                line.text.setOpacity(m_opacityCached);
+            for (auto& visibleLine : m_visibleLines)
+                visibleLine.text.setOpacity(m_opacityCached);
         }
         else if (property == U"Font")
         {
             Widget::rendererChanged(property);
-
-            for (auto& line : m_lines)
-                line.text.setFont(m_fontCached);
-
             recalculateAllLines();
         }
         else
@@ -612,6 +706,45 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool ChatBox::updateTime(Duration elapsedTime)
+    {
+        bool screenRefreshRequired = Widget::updateTime(elapsedTime);
+
+        // Take all lines that were queued since the last frame, so that the lock isn't held while adding them
+        {
+            const std::lock_guard<std::mutex> lock(m_lineQueue.mutex);
+            if (!m_lineQueue.lines.empty())
+                m_lineQueue.lines.swap(m_dequeuedLines);
+        }
+
+        if (!m_dequeuedLines.empty())
+        {
+            std::size_t firstLine = 0;
+            if ((m_maxLines > 0) && (m_dequeuedLines.size() > m_maxLines))
+                firstLine = m_dequeuedLines.size() - m_maxLines;
+
+            for (std::size_t i = firstLine; i < m_dequeuedLines.size(); ++i)
+            {
+                const QueuedLine& queuedLine = m_dequeuedLines[i];
+                insertLine(queuedLine.text,
+                           queuedLine.color.isSet() ? queuedLine.color : m_textColor,
+                           queuedLine.style.isSet() ? queuedLine.style : m_textStyle);
+            }
+
+            m_dequeuedLines.clear();
+            updateScrollbarMaximum();
+            screenRefreshRequired = true;
+        }
+
+        // Lines are only word-wrapped once they come near the visible area, which has to happen before they are drawn
+        if (wrapLinesNearView())
+            screenRefreshRequired = true;
+
+        return screenRefreshRequired;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Vector2f ChatBox::getInnerSize() const
     {
         return {std::max(0.f, getSize().x - m_bordersCached.getLeft() - m_bordersCached.getRight()),
@@ -651,10 +784,21 @@ namespace tgui
         if (!m_linesStartFromTop && (m_fullTextHeight + Text::getExtraVerticalPadding(m_textSizeCached) < getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()))
             states.transform.translate({0, getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom() - m_fullTextHeight - Text::getExtraVerticalPadding(m_textSizeCached)});
 
-        for (const auto& line : m_lines)
+        // Only the lines inside the visible area are drawn, the texts in the margin around it are only kept to make scrolling cheap
+        updateVisibleLines();
+
+        const float viewTop = static_cast<float>(m_scrollbar->getValue());
+        const float viewBottom = viewTop + getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom();
+        float lineTop = m_firstVisibleLineTop;
+        states.transform.translate({0, lineTop});
+        for (std::size_t i = 0; i < m_visibleLines.size(); ++i)
         {
-            target.drawText(states, line.text);
-            states.transform.translate({0, line.text.getSize().y});
+            const float lineHeight = m_lines[m_firstVisibleLine + i].height;
+            if ((lineTop + lineHeight > viewTop) && (lineTop < viewBottom))
+                target.drawText(states, m_visibleLines[i].text);
+
+            states.transform.translate({0, lineHeight});
+            lineTop += lineHeight;
         }
 
         target.removeClippingLayer();
@@ -662,6 +806,157 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ChatBox::findLinesInRange(float rangeTop, float rangeBottom, std::size_t& firstLine, float& firstLineTop, std::size_t& lastLine) const
+    {
+        // Find the first line that reaches into the range. We start searching from the closest end, as the view is usually at the
+        // top or bottom of the chat box and the lines don't store their position.
+        if (rangeTop <= m_fullTextHeight / 2)
+        {
+            firstLine = 0;
+            firstLineTop = 0;
+            while ((firstLine < m_lines.size()) && (firstLineTop + m_lines[firstLine].height <= rangeTop))
+                firstLineTop += m_lines[firstLine++].height;
+        }
+        else
+        {
+            firstLine = m_lines.size();
+            firstLineTop = m_fullTextHeight;
+            while ((firstLine > 0) && (firstLineTop > rangeTop))
+                firstLineTop -= m_lines[--firstLine].height;
+
+            if (firstLine == 0)
+                firstLineTop = 0;
+        }
+
+        lastLine = firstLine;
+        float lineTop = firstLineTop;
+        while ((lastLine < m_lines.size()) && (lineTop < rangeBottom))
+            lineTop += m_lines[lastLine++].height;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ChatBox::wrapLinesNearView()
+    {
+        // Wrapping the lines changes their height, which can move other unwrapped lines into the range, so we repeat until all
+        // lines in the range are wrapped. Every iteration wraps at least one more line, so this always ends.
+        bool heightsChanged = false;
+        while (true)
+        {
+            const float viewportHeight = std::max(0.f, getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom());
+            const unsigned int oldValue = m_scrollbar->getValue();
+            const float viewTop = static_cast<float>(oldValue);
+
+            // This is the same range as the one for which updateVisibleLines creates the texts
+            std::size_t firstLine;
+            float lineTop;
+            std::size_t lastLine;
+            findLinesInRange(viewTop - (viewportHeight / 2), viewTop + viewportHeight + (viewportHeight / 2), firstLine, lineTop, lastLine);
+
+            bool heightChanged = false;
+            float heightChangeAboveView = 0;
+            for (std::size_t i = firstLine; i < lastLine; ++i)
+            {
+                Line& line = m_lines[i];
+                const float oldHeight = line.height;
+                if (!line.wrapped)
+                {
+                    recalculateLineText(line);
+                    if (line.height != oldHeight)
+                    {
+                        m_fullTextHeight += line.height - oldHeight;
+                        if (lineTop + oldHeight <= viewTop)
+                            heightChangeAboveView += line.height - oldHeight;
+
+                        heightChanged = true;
+                    }
+                }
+
+                lineTop += oldHeight;
+            }
+
+            if (!heightChanged)
+                return heightsChanged;
+
+            heightsChanged = true;
+            updateScrollbarMaximum();
+
+            // Keep the lines in the view at the same place when the lines above them became higher
+            if ((heightChangeAboveView != 0) && (m_scrollbar->getValue() == oldValue))
+                m_scrollbar->setValue(static_cast<unsigned int>(std::max(0.f, viewTop + heightChangeAboveView)));
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::updateVisibleLines() const
+    {
+        // Nothing has to change as long as we only scroll within the lines that already have a text
+        const float viewportHeight = std::max(0.f, getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom());
+        const float viewTop = static_cast<float>(m_scrollbar->getValue());
+        if (!m_visibleLinesOutdated && (viewTop >= m_visibleRangeTop) && (viewTop + viewportHeight <= m_visibleRangeBottom))
+            return;
+
+        m_visibleLinesOutdated = false;
+        m_visibleRangeTop = viewTop - (viewportHeight / 2);
+        m_visibleRangeBottom = viewTop + viewportHeight + (viewportHeight / 2);
+
+        std::size_t firstLine;
+        float firstLineTop;
+        std::size_t lastLine;
+        findLinesInRange(m_visibleRangeTop, m_visibleRangeBottom, firstLine, firstLineTop, lastLine);
+
+        std::vector<VisibleLine> oldVisibleLines;
+        oldVisibleLines.swap(m_visibleLines);
+        m_visibleLines.reserve(lastLine - firstLine);
+
+        // Keep the texts of lines that were already near the visible area
+        std::vector<bool> oldVisibleLineReused(oldVisibleLines.size(), false);
+        std::vector<std::size_t> newLineIndices;
+        for (std::size_t i = firstLine; i < lastLine; ++i)
+        {
+            const std::size_t lineId = m_lines[i].id;
+            const auto it = std::find_if(oldVisibleLines.begin(), oldVisibleLines.end(),
+                                         [lineId](const VisibleLine& visibleLine){ return visibleLine.lineId == lineId; });
+            if (it != oldVisibleLines.end())
+            {
+                oldVisibleLineReused[static_cast<std::size_t>(it - oldVisibleLines.begin())] = true;
+                m_visibleLines.push_back(std::move(*it));
+            }
+            else
+            {
+                m_visibleLines.emplace_back();
+                newLineIndices.push_back(i);
+            }
+        }
+
+        // Reuse the texts that are no longer needed for the lines that became visible
+        std::size_t spareIndex = 0;
+        for (const std::size_t lineIndex : newLineIndices)
+        {
+            while ((spareIndex < oldVisibleLines.size()) && oldVisibleLineReused[spareIndex])
+                ++spareIndex;
+
+            VisibleLine& visibleLine = m_visibleLines[lineIndex - firstLine];
+            if (spareIndex < oldVisibleLines.size())
+                visibleLine.text = std::move(oldVisibleLines[spareIndex++].text);
+
+            const Line& line = m_lines[lineIndex];
+            visibleLine.lineId = line.id;
+            visibleLine.text.setColor(line.color);
+            visibleLine.text.setStyle(line.style);
+            visibleLine.text.setOpacity(m_opacityCached);
+            visibleLine.text.setCharacterSize(m_textSizeCached);
+            visibleLine.text.setFont(m_fontCached);
+            visibleLine.text.setString(getWrappedLineString(line));
+        }
+
+        m_firstVisibleLine = firstLine;
+        m_firstVisibleLineTop = firstLineTop;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Widget::Ptr ChatBox::clone() const
     {
         return std::make_shared<ChatBox>(*this);
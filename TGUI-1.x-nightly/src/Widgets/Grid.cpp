@@ -700,6 +700,9 @@ namespace tgui
 
     void Grid::updatePositionsOfAllWidgets()
     {
+        if (isBatchUpdating())
+            return;
+
         Vector2f position;
 
         // Fill the entire space when a size was given
@@ -799,6 +802,10 @@ namespace tgui
 
     void Grid::updateWidgets()
     {
+        // The grid will be updated when the batch update ends
+        if (isBatchUpdating())
+            return;
+
         // Reset the column widths
         for (float& width : m_columnWidth)
             width = 0;
@@ -832,6 +839,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Grid::batchUpdateFinished()
+    {
+        Container::batchUpdateFinished();
+        updateWidgets();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Grid::recalculateAutoSize()
     {
         Vector2f size;
@@ -497,6 +497,16 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ListBox::batchUpdateFinished()
+    {
+        Widget::batchUpdateFinished();
+
+        updateItemPositions();
+        triggerOnScroll();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListBox::setMaximumItems(std::size_t maximumItems)
     {
         // Set the new limit
@@ -1062,6 +1072,10 @@ namespace tgui
 
     void ListBox::updateItemPositions()
     {
+        // The items will be repositioned when the batch update ends
+        if (isBatchUpdating())
+            return;
+
         for (std::size_t i = 0; i < m_items.size(); ++i)
             m_items[i].text.setPosition({0, (i * m_itemHeight) + ((m_itemHeight - m_items[i].text.getSize().y) / 2.0f)});
 
@@ -1158,6 +1172,10 @@ namespace tgui
 
     void ListBox::triggerOnScroll()
     {
+        // Only the final scroll position is reported when the batch update ends
+        if (isBatchUpdating())
+            return;
+
         const unsigned int currentScrollbarValue = m_scrollbar->getValue();
         if (currentScrollbarValue == m_lastScrollbarValue)
             return;
@@ -28,6 +28,11 @@
 
 #include <cassert>
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <system_error>
+    #include <algorithm>
+    #include <numeric>
+    #include <limits>
+    #include <thread>
     #include <cmath>
 #endif
 
@@ -39,6 +44,127 @@
 
 namespace tgui
 {
+    namespace
+    {
+        // Lists with less rows per available thread are sorted on fewer threads, as starting a thread would take longer
+        constexpr std::size_t minRowsPerSortThread = 16384;
+
+        // Keys of a single column that are compared while sorting, created once before the sort starts
+        struct SortKeys
+        {
+            std::vector<std::u32string> ownedTexts; // Only filled when the keys can't refer to the texts of the items
+            std::vector<const std::u32string*> texts;
+            std::vector<float> numbers; // NaN for cells that aren't numbers
+            bool numeric = false;
+            bool descending = false;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Calls task(i) for every i below taskCount, each on its own thread
+        template <typename Function>
+        void runInParallel(std::size_t taskCount, const Function& task)
+        {
+            std::vector<std::thread> threads;
+            threads.reserve(taskCount);
+
+            std::size_t startedTasks = 1;
+            try
+            {
+                for (; startedTasks < taskCount; ++startedTasks)
+                    threads.emplace_back(task, startedTasks);
+            }
+            catch (const std::system_error&)
+            {
+                // No more threads could be created, the remaining tasks are executed on this thread
+            }
+
+            task(std::size_t{0});
+            for (std::size_t i = startedTasks; i < taskCount; ++i)
+                task(i);
+
+            for (auto& thread : threads)
+                thread.join();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t getSortThreadCount(std::size_t rowCount)
+        {
+            const std::size_t hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+            return std::max<std::size_t>(1, std::min(hardwareThreads, rowCount / minRowsPerSortThread));
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Stable sort that sorts parts of the rows on separate threads and then merges the neighbouring parts
+        template <typename Compare>
+        void parallelStableSort(std::vector<std::size_t>& rows, const Compare& cmp)
+        {
+            const std::size_t chunkCount = getSortThreadCount(rows.size());
+            if (chunkCount <= 1)
+            {
+                std::stable_sort(rows.begin(), rows.end(), cmp);
+                return;
+            }
+
+            std::vector<std::size_t> bounds(chunkCount + 1);
+            for (std::size_t i = 0; i <= chunkCount; ++i)
+                bounds[i] = rows.size() * i / chunkCount;
+
+            const auto begin = rows.begin();
+            runInParallel(chunkCount, [&](std::size_t chunk) {
+                std::stable_sort(begin + static_cast<std::ptrdiff_t>(bounds[chunk]), begin + static_cast<std::ptrdiff_t>(bounds[chunk + 1]), cmp);
+            });
+
+            // Merging keeps the sort stable as the elements of the left part come first when they are equal
+            while (bounds.size() > 2)
+            {
+                runInParallel((bounds.size() - 1) / 2, [&](std::size_t merge) {
+                    std::inplace_merge(begin + static_cast<std::ptrdiff_t>(bounds[2 * merge]),
+                                       begin + static_cast<std::ptrdiff_t>(bounds[2 * merge + 1]),
+                                       begin + static_cast<std::ptrdiff_t>(bounds[2 * merge + 2]), cmp);
+                });
+
+                std::vector<std::size_t> mergedBounds;
+                for (std::size_t i = 0; i < bounds.size(); i += 2)
+                    mergedBounds.push_back(bounds[i]);
+                if (mergedBounds.back() != bounds.back())
+                    mergedBounds.push_back(bounds.back());
+
+                bounds = std::move(mergedBounds);
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Returns a negative value if row a has to be placed above row b, a positive value if it has to be below b and 0 if equal
+        int compareSortKeys(const SortKeys& keys, std::size_t a, std::size_t b)
+        {
+            const int direction = keys.descending ? -1 : 1;
+            if (keys.numeric)
+            {
+                const float numberA = keys.numbers[a];
+                const float numberB = keys.numbers[b];
+                const bool isNumberA = !std::isnan(numberA);
+                const bool isNumberB = !std::isnan(numberB);
+
+                // Cells that aren't numbers are placed at the bottom, also when sorting in descending order
+                if (isNumberA != isNumberB)
+                    return isNumberA ? -1 : 1;
+                if (!isNumberA || (numberA == numberB))
+                    return 0;
+
+                return (numberA < numberB) ? -direction : direction;
+            }
+
+            const int result = keys.texts[a]->compare(*keys.texts[b]);
+            return (result < 0) ? -direction : ((result > 0) ? direction : 0);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 #if TGUI_COMPILED_WITH_CPP_VER < 17
     constexpr const char ListView::StaticWidgetType[];
 #endif
@@ -367,6 +493,12 @@ namespace tgui
 
     std::size_t ListView::addItem(const String& text)
     {
+        if (m_virtualItemProvider)
+        {
+            TGUI_PRINT_WARNING("ListView::addItem can't be used in virtual mode.");
+            return m_virtualItemCount;
+        }
+
         TGUI_EMPLACE_BACK(item, m_items)
         item.texts.push_back(createText(text));
         item.icon.setOpacity(m_opacityCached);
@@ -377,8 +509,7 @@ namespace tgui
         updateVerticalScrollbarMaximum();
 
         // Scroll down when auto-scrolling is enabled
-        if (m_autoScroll && (m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum()))
-            m_verticalScrollbar->setValue(m_verticalScrollbar->getMaximum() - m_verticalScrollbar->getViewportSize());
+        autoScrollToBottom();
 
         return m_items.size()-1;
     }
@@ -387,6 +518,12 @@ namespace tgui
 
     std::size_t ListView::addItem(const std::vector<String>& itemTexts)
     {
+        if (m_virtualItemProvider)
+        {
+            TGUI_PRINT_WARNING("ListView::addItem can't be used in virtual mode.");
+            return m_virtualItemCount;
+        }
+
         TGUI_EMPLACE_BACK(item, m_items)
         item.texts.reserve(itemTexts.size());
         for (const auto& text : itemTexts)
@@ -400,8 +537,7 @@ namespace tgui
         updateVerticalScrollbarMaximum();
 
         // Scroll down when auto-scrolling is enabled
-        if (m_autoScroll && (m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum()))
-            m_verticalScrollbar->setValue(m_verticalScrollbar->getMaximum() - m_verticalScrollbar->getViewportSize());
+        autoScrollToBottom();
 
         return m_items.size()-1;
     }
@@ -410,6 +546,12 @@ namespace tgui
 
     void ListView::addMultipleItems(const std::vector<std::vector<String>>& items)
     {
+        if (m_virtualItemProvider)
+        {
+            TGUI_PRINT_WARNING("ListView::addMultipleItems can't be used in virtual mode.");
+            return;
+        }
+
         bool columnWidthChanged = false;
         for (const auto& itemToInsert : items)
         {
@@ -429,8 +571,7 @@ namespace tgui
         updateVerticalScrollbarMaximum();
 
         // Scroll down when auto-scrolling is enabled
-        if (m_autoScroll && (m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum()))
-            m_verticalScrollbar->setValue(m_verticalScrollbar->getMaximum() - m_verticalScrollbar->getViewportSize());
+        autoScrollToBottom();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -714,6 +855,12 @@ namespace tgui
 
         m_items.clear();
 
+        m_virtualItemProvider = nullptr;
+        m_virtualItemCount = 0;
+        m_virtualItemOrder.clear();
+        m_virtualItems.clear();
+        m_virtualItemPool.clear();
+
         m_iconCount = 0;
         m_maxIconWidth = m_fixedIconSize.x;
 
@@ -727,7 +874,7 @@ namespace tgui
 
     void ListView::setSelectedItem(std::size_t index)
     {
-        if (index >= m_items.size())
+        if (index >= getItemCount())
         {
             updateSelectedItem(-1);
             return;
@@ -912,19 +1059,25 @@ namespace tgui
 
     std::size_t ListView::getItemCount() const
     {
-        return m_items.size();
+        if (m_virtualItemProvider)
+            return m_virtualItemCount;
+        else
+            return m_items.size();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     String ListView::getItemCell(std::size_t rowIndex, std::size_t columnIndex) const
     {
-        if (rowIndex >= m_items.size())
+        if (rowIndex >= getItemCount())
             return "";
 
         if (columnIndex != 0 && columnIndex >= m_columns.size())
             return "";
 
+        if (m_virtualItemProvider)
+            return m_virtualItemProvider(m_virtualItemOrder.empty() ? rowIndex : m_virtualItemOrder[rowIndex], columnIndex);
+
         if (columnIndex < m_items[rowIndex].texts.size())
             return m_items[rowIndex].texts[columnIndex].getString();
 
@@ -935,6 +1088,9 @@ namespace tgui
 
     String ListView::getItem(std::size_t index) const
     {
+        if (m_virtualItemProvider)
+            return getItemCell(index, 0);
+
         if (index >= m_items.size())
             return "";
 
@@ -949,7 +1105,12 @@ namespace tgui
     std::vector<String> ListView::getItemRow(std::size_t index) const
     {
         std::vector<String> row;
-        if (index < m_items.size())
+        if (m_virtualItemProvider)
+        {
+            for (std::size_t column = 0; column < std::max<std::size_t>(1, m_columns.size()); ++column)
+                row.push_back(getItemCell(index, column));
+        }
+        else if (index < m_items.size())
         {
             for (const auto& text : m_items[index].texts)
                 row.push_back(text.getString());
@@ -963,34 +1124,117 @@ namespace tgui
 
     void ListView::sort(std::size_t index, const std::function<bool(const String&, const String&)>& cmp)
     {
-        if (index >= m_items.size())
+        if (!m_virtualItemProvider && (index >= m_items.size()))
+            return;
+
+        // Read each cell only once and sort the indices instead of the items
+        const std::size_t itemCount = getItemCount();
+        std::vector<String> keys(itemCount);
+        for (std::size_t i = 0; i < itemCount; ++i)
+            keys[i] = getItemCell(i, index);
+
+        std::vector<std::size_t> order(itemCount);
+        std::iota(order.begin(), order.end(), std::size_t{0});
+        std::stable_sort(order.begin(), order.end(), [&keys, &cmp](std::size_t a, std::size_t b) { return cmp(keys[a], keys[b]); });
+
+        applySortOrder(order);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::sort(const std::vector<SortColumn>& columns)
+    {
+        const std::size_t itemCount = getItemCount();
+        if (columns.empty() || (itemCount == 0))
             return;
 
-        std::sort(m_items.begin(), m_items.end(),
-            [index, &cmp](const ListView::Item &a, const ListView::Item& b)
+        static const std::u32string emptyText;
+
+        std::vector<SortKeys> keys(columns.size());
+        for (std::size_t c = 0; c < columns.size(); ++c)
+        {
+            SortKeys& columnKeys = keys[c];
+            const SortColumn& column = columns[c];
+            columnKeys.numeric = (column.type == SortType::Numeric);
+            columnKeys.descending = column.descending;
+
+            if (columnKeys.numeric)
+                columnKeys.numbers.resize(itemCount);
+            else
             {
-                String s1;
-                if (index < a.texts.size())
-                    s1 = a.texts[index].getString();
+                columnKeys.texts.resize(itemCount);
+                if (m_virtualItemProvider || (column.type == SortType::TextCaseInsensitive))
+                    columnKeys.ownedTexts.resize(itemCount);
+            }
 
-                String s2;
-                if (index < b.texts.size())
-                    s2 = b.texts[index].getString();
+            const auto createKey = [&columnKeys, &column](std::size_t row, const String& cell) {
+                if (columnKeys.numeric)
+                {
+                    float number;
+                    columnKeys.numbers[row] = cell.attemptToFloat(number) ? number : std::numeric_limits<float>::quiet_NaN();
+                }
+                else if (column.type == SortType::TextCaseInsensitive)
+                {
+                    columnKeys.ownedTexts[row] = cell.toLower().toUtf32();
+                    columnKeys.texts[row] = &columnKeys.ownedTexts[row];
+                }
+                else if (!columnKeys.ownedTexts.empty())
+                {
+                    columnKeys.ownedTexts[row] = cell.toUtf32();
+                    columnKeys.texts[row] = &columnKeys.ownedTexts[row];
+                }
+                else // The key can refer to the text of the item, which doesn't change while sorting
+                    columnKeys.texts[row] = &cell.toUtf32();
+            };
 
-                return cmp(s1, s2);
-            });
+            if (m_virtualItemProvider)
+            {
+                // The provider isn't required to be thread-safe, so the cells are requested from this thread
+                for (std::size_t row = 0; row < itemCount; ++row)
+                    createKey(row, getItemCell(row, column.index));
+            }
+            else
+            {
+                const std::size_t chunkCount = getSortThreadCount(itemCount);
+                runInParallel(chunkCount, [&](std::size_t chunk) {
+                    const std::size_t lastRow = itemCount * (chunk + 1) / chunkCount;
+                    for (std::size_t row = itemCount * chunk / chunkCount; row < lastRow; ++row)
+                    {
+                        const auto& texts = m_items[row].texts;
+                        if (column.index < texts.size())
+                            createKey(row, texts[column.index].getString());
+                        else if (columnKeys.numeric)
+                            columnKeys.numbers[row] = std::numeric_limits<float>::quiet_NaN();
+                        else
+                            columnKeys.texts[row] = &emptyText;
+                    }
+                });
+            }
+        }
 
-        // While the width of the widest item didn't change, its index might have, so we need to locate it again
-        updateWidestItem();
+        std::vector<std::size_t> order(itemCount);
+        std::iota(order.begin(), order.end(), std::size_t{0});
+        parallelStableSort(order, [&keys](std::size_t a, std::size_t b) {
+            for (const auto& columnKeys : keys)
+            {
+                const int result = compareSortKeys(columnKeys, a, b);
+                if (result != 0)
+                    return (result < 0);
+            }
+
+            return false;
+        });
+
+        applySortOrder(order);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::vector<String> ListView::getItems() const
     {
-        std::vector<String> items(m_items.size());
+        std::vector<String> items(getItemCount());
 
-        for (std::size_t i = 0; i < m_items.size(); i++)
+        for (std::size_t i = 0; i < items.size(); i++)
             items[i] = getItemCell(i, 0);
 
         return items;
@@ -1001,6 +1245,14 @@ namespace tgui
     std::vector<std::vector<String>> ListView::getItemRows() const
     {
         std::vector<std::vector<String>> rows;
+        if (m_virtualItemProvider)
+        {
+            rows.reserve(m_virtualItemCount);
+            for (std::size_t i = 0; i < m_virtualItemCount; ++i)
+                rows.push_back(getItemRow(i));
+
+            return rows;
+        }
 
         for (const auto& item : m_items)
         {
@@ -1017,6 +1269,102 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ListView::setVirtualItems(std::size_t itemCount, ItemProvider provider, float itemWidthHint)
+    {
+        removeAllItems();
+        if (!provider)
+            return;
+
+        m_virtualItemProvider = std::move(provider);
+        m_virtualItemCount = itemCount;
+        m_virtualItemWidthHint = itemWidthHint;
+        m_virtualFirstItem = 0;
+        m_virtualItemsValid = false;
+
+        if (updateWidestItem())
+            updateColumnWidths();
+
+        updateVerticalScrollbarMaximum();
+
+        // Scroll down when auto-scrolling is enabled
+        autoScrollToBottom();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::setVirtualItemCount(std::size_t itemCount)
+    {
+        if (!m_virtualItemProvider)
+        {
+            TGUI_PRINT_WARNING("ListView::setVirtualItemCount called while not in virtual mode.");
+            return;
+        }
+
+        if (itemCount == m_virtualItemCount)
+            return;
+
+        const std::size_t oldItemCount = m_virtualItemCount;
+        if (itemCount < oldItemCount)
+        {
+            if (m_hoveredItem >= static_cast<int>(itemCount))
+                updateHoveredItem(-1);
+
+            std::set<std::size_t> remainingSelectedItems;
+            for (const std::size_t selectedItem : m_selectedItems)
+            {
+                if (selectedItem < itemCount)
+                    remainingSelectedItems.insert(selectedItem);
+            }
+
+            if (remainingSelectedItems.size() != m_selectedItems.size())
+            {
+                if (m_multiSelect)
+                    setSelectedItems(remainingSelectedItems);
+                else
+                    updateSelectedItem(-1);
+            }
+
+            if (m_focusedItemIndex >= static_cast<int>(itemCount))
+                m_focusedItemIndex = itemCount > 0 ? static_cast<int>(itemCount - 1) : -1;
+
+            if (!m_virtualItemOrder.empty())
+            {
+                m_virtualItemOrder.erase(std::remove_if(m_virtualItemOrder.begin(), m_virtualItemOrder.end(),
+                    [itemCount](std::size_t row) { return row >= itemCount; }), m_virtualItemOrder.end());
+            }
+        }
+        else if (!m_virtualItemOrder.empty())
+        {
+            for (std::size_t row = oldItemCount; row < itemCount; ++row)
+                m_virtualItemOrder.push_back(row);
+        }
+
+        m_virtualItemCount = itemCount;
+        m_virtualItemsValid = false;
+
+        updateVerticalScrollbarMaximum();
+
+        // Scroll down when auto-scrolling is enabled and rows were added
+        if (itemCount > oldItemCount)
+            autoScrollToBottom();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::refreshVirtualItems()
+    {
+        m_virtualItemsValid = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ListView::isVirtual() const
+    {
+        return static_cast<bool>(m_virtualItemProvider);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListView::setItemHeight(unsigned int itemHeight)
     {
         m_itemHeight = itemHeight;
@@ -1047,6 +1395,8 @@ namespace tgui
         if ((m_textSize == 0) && !getSharedRenderer()->getTextSize())
             m_textSizeCached = Text::findBestTextSize(m_fontCached, m_itemHeight * 0.8f);
 
+        m_virtualItemsValid = false;
+
         for (auto& item : m_items)
         {
             for (auto& text : item.texts)
@@ -1679,7 +2029,7 @@ namespace tgui
             else // Only one item should be selected
                 setSelectedItem(indexAbove);
         }
-        else if (event.code == Event::KeyboardKey::Down && (m_focusedItemIndex + 1 < static_cast<int>(m_items.size())))
+        else if (event.code == Event::KeyboardKey::Down && (m_focusedItemIndex + 1 < static_cast<int>(getItemCount())))
         {
             const std::size_t indexBelow = (m_focusedItemIndex >= 0) ? static_cast<std::size_t>(m_focusedItemIndex) + 1 : 0;
             if (m_multiSelect && keyboard::isShiftPressed(event))
@@ -1702,8 +2052,16 @@ namespace tgui
             for (const std::size_t index : m_selectedItems)
             {
                 String temp;
-                for (const auto& text : m_items[index].texts)
-                    temp.append(text.getString() + '\t');
+                if (m_virtualItemProvider)
+                {
+                    for (const auto& cell : getItemRow(index))
+                        temp.append(cell + '\t');
+                }
+                else
+                {
+                    for (const auto& text : m_items[index].texts)
+                        temp.append(text.getString() + '\t');
+                }
 
                 if (*temp.rbegin() == '\t')
                     temp.pop_back();
@@ -1745,6 +2103,9 @@ namespace tgui
 
     void ListView::rendererChanged(const String& property)
     {
+        // The visible items in virtual mode are recreated with the new properties when they are drawn again
+        m_virtualItemsValid = false;
+
         if (property == U"Borders")
         {
             m_bordersCached = getSharedRenderer()->getBorders();
@@ -2183,6 +2544,18 @@ namespace tgui
 
     void ListView::setItemColor(std::size_t index, const Color& color)
     {
+        if (m_virtualItemProvider)
+        {
+            // Only the visible items exist in virtual mode, others get the correct color when they become visible
+            if ((index < m_virtualFirstItem) || (index >= m_virtualFirstItem + m_virtualItems.size()))
+                return;
+
+            for (auto& text : m_virtualItems[index - m_virtualFirstItem].texts)
+                text.setColor(color);
+
+            return;
+        }
+
         for (auto& text : m_items[index].texts)
             text.setColor(color);
     }
@@ -2341,6 +2714,14 @@ namespace tgui
 
         widestItemWidth = 0;
         widestItemIndex = std::numeric_limits<unsigned int>::max();
+
+        // The items aren't measured in virtual mode, the width that was passed to setVirtualItems is used instead
+        if (m_virtualItemProvider)
+        {
+            widestItemWidth = m_virtualItemWidthHint;
+            return (widestItemWidth != oldWidestItemWidth);
+        }
+
         for (unsigned int i = 0; i < m_items.size(); ++i)
         {
             const auto& item = m_items[i];
@@ -2448,6 +2829,10 @@ namespace tgui
 
     void ListView::updateColumnWidths()
     {
+        // The columns will be updated when the batch update ends
+        if (isBatchUpdating())
+            return;
+
         float totalColumnsWidth = 0;
         if (m_columns.empty())
             totalColumnsWidth = m_widestItemWidth;
@@ -2588,7 +2973,7 @@ namespace tgui
         else
             hoveredItem = static_cast<int>(std::ceil((mousePos.y + m_verticalScrollbar->getValue() - m_itemHeight + 1) / m_itemHeight));
 
-        if ((hoveredItem >= 0) && (hoveredItem < static_cast<int>(m_items.size())))
+        if ((hoveredItem >= 0) && (hoveredItem < static_cast<int>(getItemCount())))
             updateHoveredItem(hoveredItem);
         else
             updateHoveredItem(-1);
@@ -2757,11 +3142,16 @@ namespace tgui
 
     void ListView::updateVerticalScrollbarMaximum()
     {
+        // The scrollbar will be updated when the batch update ends
+        if (isBatchUpdating())
+            return;
+
         const bool verticalScrollbarAtBottom = (m_verticalScrollbar->getValue() + m_verticalScrollbar->getViewportSize() >= m_verticalScrollbar->getMaximum());
 
-        unsigned int maximum = static_cast<unsigned int>(m_items.size() * m_itemHeight);
-        if (m_showHorizontalGridLines && (m_gridLinesWidth > 0) && !m_items.empty())
-            maximum += static_cast<unsigned int>((m_items.size() - 1) * m_gridLinesWidth);
+        const std::size_t itemCount = getItemCount();
+        unsigned int maximum = static_cast<unsigned int>(itemCount * m_itemHeight);
+        if (m_showHorizontalGridLines && (m_gridLinesWidth > 0) && (itemCount > 0))
+            maximum += static_cast<unsigned int>((itemCount - 1) * m_gridLinesWidth);
 
         m_verticalScrollbar->setMaximum(maximum);
         updateScrollbars();
@@ -2773,6 +3163,40 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ListView::autoScrollToBottom()
+    {
+        if (!m_autoScroll)
+            return;
+
+        // The scrollbar maximum is outdated during a batch update, so we scroll once the batch ends
+        if (isBatchUpdating())
+        {
+            m_autoScrollPending = true;
+            return;
+        }
+
+        if (m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum())
+            m_verticalScrollbar->setValue(m_verticalScrollbar->getMaximum() - m_verticalScrollbar->getViewportSize());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::batchUpdateFinished()
+    {
+        Widget::batchUpdateFinished();
+
+        updateColumnWidths();
+        updateVerticalScrollbarMaximum();
+
+        if (m_autoScrollPending)
+        {
+            m_autoScrollPending = false;
+            autoScrollToBottom();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListView::drawHeaderText(BackendRenderTarget& target, RenderStates states, float columnWidth, float headerHeight, std::size_t column) const
     {
         if (column >= m_columns.size())
@@ -2799,6 +3223,165 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ListView::applySortOrder(const std::vector<std::size_t>& order)
+    {
+        // The hovered item depends on the mouse position, it will be updated when the mouse moves
+        updateHoveredItem(-1);
+
+        std::vector<std::size_t> newIndices(order.size());
+        for (std::size_t i = 0; i < order.size(); ++i)
+            newIndices[order[i]] = i;
+
+        // The selected items stay selected at their new position
+        const int oldSelectedItemIndex = getSelectedItemIndex();
+        std::set<std::size_t> selectedItems;
+        for (const std::size_t selectedItem : m_selectedItems)
+            selectedItems.insert(newIndices[selectedItem]);
+
+        m_selectedItems = std::move(selectedItems);
+        if (m_firstSelectedItemIndex >= 0)
+            m_firstSelectedItemIndex = static_cast<int>(newIndices[static_cast<std::size_t>(m_firstSelectedItemIndex)]);
+        if (m_focusedItemIndex >= 0)
+            m_focusedItemIndex = static_cast<int>(newIndices[static_cast<std::size_t>(m_focusedItemIndex)]);
+
+        if (m_virtualItemProvider)
+        {
+            if (m_virtualItemOrder.empty())
+                m_virtualItemOrder = order;
+            else
+            {
+                std::vector<std::size_t> newOrder(order.size());
+                for (std::size_t i = 0; i < order.size(); ++i)
+                    newOrder[i] = m_virtualItemOrder[order[i]];
+
+                m_virtualItemOrder = std::move(newOrder);
+            }
+
+            m_virtualItemsValid = false;
+        }
+        else
+        {
+            std::vector<Item> sortedItems;
+            sortedItems.reserve(m_items.size());
+            for (const std::size_t index : order)
+                sortedItems.push_back(std::move(m_items[index]));
+
+            m_items = std::move(sortedItems);
+
+            // While the width of the widest item didn't change, its index might have, so we need to locate it again
+            updateWidestItem();
+        }
+
+        if (getSelectedItemIndex() != oldSelectedItemIndex)
+            onItemSelect.emit(this, getSelectedItemIndex());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const Color& ListView::getItemTextColor(std::size_t index) const
+    {
+        const bool hovered = (static_cast<int>(index) == m_hoveredItem);
+        if (m_selectedItems.find(index) != m_selectedItems.end())
+        {
+            if (hovered && m_selectedTextColorHoverCached.isSet())
+                return m_selectedTextColorHoverCached;
+            else if (m_selectedTextColorCached.isSet())
+                return m_selectedTextColorCached;
+        }
+
+        if (hovered && m_textColorHoverCached.isSet())
+            return m_textColorHoverCached;
+        else
+            return m_textColorCached;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::updateVirtualItems(std::size_t firstItem, std::size_t lastItem) const
+    {
+        if (!m_virtualItemsValid)
+        {
+            for (auto& item : m_virtualItems)
+                m_virtualItemPool.push_back(std::move(item));
+
+            m_virtualItems.clear();
+            m_virtualItemsValid = true;
+        }
+        else if ((firstItem == m_virtualFirstItem) && (lastItem - firstItem == m_virtualItems.size()))
+            return;
+
+        // Release the items of rows that scrolled out of view
+        const std::size_t oldFirstItem = m_virtualFirstItem;
+        const std::size_t oldLastItem = m_virtualFirstItem + m_virtualItems.size();
+        for (std::size_t i = oldFirstItem; i < oldLastItem; ++i)
+        {
+            if ((i < firstItem) || (i >= lastItem))
+                m_virtualItemPool.push_back(std::move(m_virtualItems[i - oldFirstItem]));
+        }
+
+        std::vector<Item> visibleItems;
+        visibleItems.reserve(lastItem - firstItem);
+        for (std::size_t i = firstItem; i < lastItem; ++i)
+        {
+            if ((i >= oldFirstItem) && (i < oldLastItem))
+            {
+                visibleItems.push_back(std::move(m_virtualItems[i - oldFirstItem]));
+                continue;
+            }
+
+            if (!m_virtualItemPool.empty())
+            {
+                visibleItems.push_back(std::move(m_virtualItemPool.back()));
+                m_virtualItemPool.pop_back();
+            }
+            else
+                visibleItems.emplace_back();
+
+            fillVirtualItem(visibleItems.back(), i);
+        }
+
+        m_virtualItems = std::move(visibleItems);
+        m_virtualFirstItem = firstItem;
+
+        // Don't keep more spare items around than there are visible rows
+        if (m_virtualItemPool.size() > m_virtualItems.size())
+            m_virtualItemPool.resize(m_virtualItems.size());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::fillVirtualItem(Item& item, std::size_t index) const
+    {
+        const std::size_t columnCount = std::max<std::size_t>(1, m_columns.size());
+        const Color& color = getItemTextColor(index);
+
+        item.texts.resize(columnCount);
+        for (std::size_t column = 0; column < columnCount; ++column)
+        {
+            Text& text = item.texts[column];
+            text.setFont(m_fontCached);
+            text.setColor(color);
+            text.setOpacity(m_opacityCached);
+            text.setCharacterSize(m_textSizeCached);
+            text.setString(getItemCell(index, column));
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const ListView::Item& ListView::getDrawnItem(std::size_t index) const
+    {
+        if (m_virtualItemProvider)
+        {
+            TGUI_ASSERT((index >= m_virtualFirstItem) && (index < m_virtualFirstItem + m_virtualItems.size()), "Only visible rows can be drawn in virtual mode");
+            return m_virtualItems[index - m_virtualFirstItem];
+        }
+
+        return m_items[index];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListView::drawColumn(BackendRenderTarget& target, RenderStates states, std::size_t firstItem, std::size_t lastItem, std::size_t column, float columnWidth) const
     {
         if (firstItem == lastItem)
@@ -2820,16 +3403,17 @@ namespace tgui
 
             for (std::size_t i = firstItem; i < lastItem; ++i)
             {
-                if (!m_items[i].icon.isSet())
+                const Item& item = getDrawnItem(i);
+                if (!item.icon.isSet())
                 {
                     states.transform.translate({0, static_cast<float>(requiredItemHeight)});
                     continue;
                 }
 
-                const float verticalIconOffset = (m_itemHeight - m_items[i].icon.getSize().y) / 2.f;
+                const float verticalIconOffset = (m_itemHeight - item.icon.getSize().y) / 2.f;
 
                 states.transform.translate({textPadding, verticalIconOffset});
-                target.drawSprite(states, m_items[i].icon);
+                target.drawSprite(states, item.icon);
                 states.transform.translate({-textPadding, static_cast<float>(requiredItemHeight) - verticalIconOffset});
             }
 
@@ -2847,7 +3431,8 @@ namespace tgui
         states.transform.translate({0, (requiredItemHeight * firstItem) - static_cast<float>(m_verticalScrollbar->getValue())});
         for (std::size_t i = firstItem; i < lastItem; ++i)
         {
-            if (column >= m_items[i].texts.size())
+            const Item& item = getDrawnItem(i);
+            if (column >= item.texts.size())
             {
                 states.transform.translate({0, static_cast<float>(requiredItemHeight)});
                 continue;
@@ -2857,12 +3442,12 @@ namespace tgui
             if ((column >= m_columns.size()) || (m_columns[column].alignment == HorizontalAlignment::Left))
                 translateX = textPadding;
             else if (m_columns[column].alignment == HorizontalAlignment::Center)
-                translateX = (columnWidth - m_items[i].texts[column].getSize().x) / 2.f;
+                translateX = (columnWidth - item.texts[column].getSize().x) / 2.f;
             else // if (m_columns[column].alignment == HorizontalAlignment::Right)
-                translateX = columnWidth - textPadding - m_items[i].texts[column].getSize().x;
+                translateX = columnWidth - textPadding - item.texts[column].getSize().x;
 
             states.transform.translate({translateX, verticalTextOffset});
-            target.drawText(states, m_items[i].texts[column]);
+            target.drawText(states, item.texts[column]);
             states.transform.translate({-translateX, static_cast<float>(requiredItemHeight) - verticalTextOffset});
         }
 
@@ -2906,16 +3491,20 @@ namespace tgui
         const unsigned int totalItemHeight = m_itemHeight + (m_showHorizontalGridLines ? m_gridLinesWidth : 0);
 
         // Find out which items are visible
+        const std::size_t itemCount = getItemCount();
         std::size_t firstItem = 0;
-        std::size_t lastItem = m_items.size();
+        std::size_t lastItem = itemCount;
         if (m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum())
         {
             firstItem = m_verticalScrollbar->getValue() / totalItemHeight;
             lastItem = ((static_cast<std::size_t>(m_verticalScrollbar->getValue()) + m_verticalScrollbar->getViewportSize()) / totalItemHeight) + 1;
-            if (lastItem > m_items.size())
-                lastItem = m_items.size();
+            if (lastItem > itemCount)
+                lastItem = itemCount;
         }
 
+        if (m_virtualItemProvider)
+            updateVirtualItems(firstItem, lastItem);
+
         states.transform.translate({m_paddingCached.getLeft(), m_paddingCached.getTop()});
 
         // Draw the scrollbars
@@ -2958,7 +3547,7 @@ namespace tgui
             target.addClippingLayer(states, {{}, {availableWidth, innerHeight - totalHeaderHeight}});
 
             // Draw the horizontal grid lines
-            if (m_showHorizontalGridLines && (m_gridLinesWidth > 0) && !m_items.empty())
+            if (m_showHorizontalGridLines && (m_gridLinesWidth > 0) && (itemCount > 0))
             {
                 Transform transformBeforeGridLines = states.transform;
 
@@ -28,12 +28,36 @@
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <cmath>
+    #include <iterator>
+    #include <algorithm>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        // Replaces count elements starting at first with the elements from replacement.
+        // Elements are overwritten where possible, so that the elements behind the range only have to move when the size differs.
+        template <typename T>
+        void replaceRange(std::vector<T>& elements, std::size_t first, std::size_t count, std::vector<T>& replacement)
+        {
+            const std::size_t overlap = std::min(count, replacement.size());
+            const auto firstIt = elements.begin() + static_cast<std::ptrdiff_t>(first);
+            std::move(replacement.begin(), replacement.begin() + static_cast<std::ptrdiff_t>(overlap), firstIt);
+
+            if (count > overlap)
+                elements.erase(firstIt + static_cast<std::ptrdiff_t>(overlap), firstIt + static_cast<std::ptrdiff_t>(count));
+            else
+                elements.insert(firstIt + static_cast<std::ptrdiff_t>(overlap),
+                                std::make_move_iterator(replacement.begin() + static_cast<std::ptrdiff_t>(overlap)),
+                                std::make_move_iterator(replacement.end()));
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 #if TGUI_COMPILED_WITH_CPP_VER < 17
     constexpr const char TextArea::StaticWidgetType[];
 #endif
@@ -121,8 +145,11 @@ namespace tgui
 
         updateScrollbars();
 
-        // The size of the text area has changed, update the text
-        rearrangeText(true);
+        // The size of the text area has changed, update the text. Without word-wrap the lines don't depend on the width.
+        if ((getWordWrapWidth() == 0) && !m_paragraphLineCounts.empty() && (m_fontCached != nullptr))
+            finishRearrangeText(getSelectionStart(), getSelectionEnd(), true, true);
+        else
+            rearrangeText(true);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -147,7 +174,18 @@ namespace tgui
 
     void TextArea::addText(String text)
     {
-        setText(m_text + std::move(text));
+        // Don't allow the text to contain carriage returns
+        text.replace('\r', U"");
+
+        // Remove the characters that don't fit when a character limit is set
+        if ((m_maxChars > 0) && (m_text.length() + text.length() > m_maxChars))
+            text.erase(m_maxChars - std::min(m_maxChars, m_text.length()));
+
+        // Only the last paragraph has to be rearranged, the text before it is unchanged
+        m_text += text;
+        rearrangeChangedLines(m_lines.empty() ? 0 : m_lines.size() - 1, m_lines.empty() ? 0 : m_lines.size() - 1, false);
+
+        onTextChange.emit(this, m_text);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -242,6 +280,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void TextArea::scrollbarValueChanged(Orientation)
+    {
+        recalculateVisibleLines();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TextArea::setMaximumCharacters(std::size_t maxChars)
     {
         // Set the new character limit ( 0 to disable the limit )
@@ -429,6 +474,7 @@ namespace tgui
     void TextArea::setVerticalScrollbarValue(unsigned int value)
     {
         m_verticalScrollbar->setValue(value);
+        recalculateVisibleLines();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -801,6 +847,7 @@ namespace tgui
             deleteSelectedCharacters();
 
             const std::size_t caretPosition = getSelectionEnd();
+            const std::size_t changedLine = m_selEnd.y;
 
             m_text.insert(caretPosition, 1, key);
             m_lines[m_selEnd.y].insert(m_selEnd.x, 1, key);
@@ -813,7 +860,7 @@ namespace tgui
             }
 
             // Do not emit onCaretPositionChanged signal yet, as it could be invalid.
-            rearrangeText(true, false);
+            rearrangeChangedLines(changedLine, changedLine, true, false);
         };
 
         // If there is a scrollbar then inserting can't go wrong
@@ -973,6 +1020,9 @@ namespace tgui
     {
         if (m_selStart != m_selEnd)
         {
+            const std::size_t firstChangedLine = std::min(m_selStart.y, m_selEnd.y);
+            const std::size_t lastChangedLine = std::max(m_selStart.y, m_selEnd.y);
+
             const std::size_t selStart = getSelectionStart();
             const std::size_t selEnd = getSelectionEnd();
             if (selStart <= selEnd)
@@ -986,7 +1036,7 @@ namespace tgui
                 m_selStart = m_selEnd;
             }
 
-            rearrangeText(true);
+            rearrangeChangedLines(firstChangedLine, lastChangedLine, true);
         }
     }
 
@@ -1006,12 +1056,13 @@ namespace tgui
             return;
 
         // Insert string.
+        const std::size_t changedLine = m_selEnd.y;
         m_text.insert(getSelectionEnd(), text);
         m_lines[m_selEnd.y].insert(m_selEnd.x, text);
 
         m_selEnd.x += text.length();
         m_selStart = m_selEnd;
-        rearrangeText(true, false);
+        rearrangeChangedLines(changedLine, changedLine, true, false);
         onCaretPositionChange.emit(this);
 
         onTextChange.emit(this, m_text);
@@ -1240,6 +1291,10 @@ namespace tgui
             const std::size_t pos = getSelectionEnd();
             if (pos > 0)
             {
+                // The removed character is either on the line of the caret or at the end of the line above it
+                const std::size_t lastChangedLine = m_selEnd.y;
+                const std::size_t firstChangedLine = (m_selEnd.y > 0) ? m_selEnd.y - 1 : 0;
+
                 if (m_selEnd.x > 0)
                 {
                     // There is a specific case that we have to watch out for. When we are removing the last character on
@@ -1270,7 +1325,7 @@ namespace tgui
                 m_text.erase(pos - 1, 1);
                 // If the "special case" above passes, and we let rearrangeText() emit the onCaretPositionChange signal,
                 // the same signal will be emitted twice. So prevent sending signal in rearrangeText() and always send it manually afterwards.
-                rearrangeText(true, false);
+                rearrangeChangedLines(firstChangedLine, lastChangedLine, true, false);
                 onCaretPositionChange.emit(this);
             }
         }
@@ -1294,8 +1349,12 @@ namespace tgui
         // Check that we did not select any characters
         if (m_selStart == m_selEnd)
         {
+            // The removed character is either on the line of the caret or at the start of the line below it
+            const std::size_t firstChangedLine = m_selEnd.y;
+            const std::size_t lastChangedLine = std::min(m_selEnd.y + 1, m_lines.size() - 1);
+
             m_text.erase(getSelectionEnd(), 1);
-            rearrangeText(true);
+            rearrangeChangedLines(firstChangedLine, lastChangedLine, true);
         }
         else // You did select some characters, so remove them
             deleteSelectedCharacters();
@@ -1360,24 +1419,17 @@ namespace tgui
     {
         // Don't continue when line height is 0 or when there is no font yet
         if ((m_lineHeight == 0) || (m_fontCached == nullptr))
+        {
+            m_paragraphLineCounts.clear();
             return;
+        }
 
-        String string;
-        if (m_horizontalScrollbar->getPolicy() != Scrollbar::Policy::Never)
-            string = m_text;
-        else
+        // Don't do anything when there is no room for the text
+        const float wordWrapWidth = getWordWrapWidth();
+        if (wordWrapWidth < 0)
         {
-            // Find the maximum width of one line
-            const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSizeCached);
-            float maxLineWidth = getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight() - 2 * textOffset;
-            if (m_verticalScrollbar->isShown())
-                maxLineWidth -= m_verticalScrollbar->getSize().x;
-
-            // Don't do anything when there is no room for the text
-            if (maxLineWidth <= 0)
-                return;
-
-            string = Text::wordWrap(maxLineWidth, m_text, m_fontCached, m_textSizeCached, false);
+            m_paragraphLineCounts.clear();
+            return;
         }
 
         // Store the current selection position when we are keeping the selection
@@ -1385,45 +1437,173 @@ namespace tgui
         const std::size_t selEnd = keepSelection ? getSelectionEnd() : 0;
 
         // Split the string in multiple lines
-        m_maxLineWidth = 0;
         m_lines.clear();
-        std::size_t searchPosStart = 0;
-        std::size_t newLinePos = 0;
-        std::size_t longestLineCharCount = 0;
-        std::size_t longestLineIndex = 0;
-        while (newLinePos != String::npos)
+        m_lineWidths.clear();
+        m_paragraphLineCounts.clear();
+        splitTextIntoLines(m_text, wordWrapWidth, m_lines, m_paragraphLineCounts, m_lineWidths);
+
+        m_maxLineWidth = 0;
+        for (const float lineWidth : m_lineWidths)
+            m_maxLineWidth = std::max(m_maxLineWidth, lineWidth);
+
+        finishRearrangeText(selStart, selEnd, keepSelection, emitCaretChangedPosition);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextArea::rearrangeChangedLines(std::size_t firstLine, std::size_t lastLine, bool keepSelection, bool emitCaretChangedPosition)
+    {
+        const float wordWrapWidth = getWordWrapWidth();
+        if (m_paragraphLineCounts.empty() || m_lines.empty() || (m_lineHeight == 0) || (m_fontCached == nullptr) || (wordWrapWidth < 0))
+        {
+            rearrangeText(keepSelection, emitCaretChangedPosition);
+            return;
+        }
+
+        lastLine = std::min(lastLine, m_lines.size() - 1);
+        firstLine = std::min(firstLine, lastLine);
+
+        // Store the current selection position when we are keeping the selection
+        const std::size_t selStart = keepSelection ? getSelectionStart() : 0;
+        const std::size_t selEnd = keepSelection ? getSelectionEnd() : 0;
+
+        // Find the paragraphs that contain the changed lines
+        std::size_t firstParagraph = 0;
+        std::size_t firstParagraphLine = 0;
+        while (firstParagraphLine + m_paragraphLineCounts[firstParagraph] <= firstLine)
+            firstParagraphLine += m_paragraphLineCounts[firstParagraph++];
+
+        std::size_t lastParagraph = firstParagraph;
+        std::size_t endLine = firstParagraphLine + m_paragraphLineCounts[firstParagraph];
+        while (endLine <= lastLine)
+            endLine += m_paragraphLineCounts[++lastParagraph];
+
+        // The lines outside these paragraphs didn't change, so they tell which part of the text has to be rearranged.
+        // Every paragraph except for the last one is followed by a newline character.
+        std::size_t charsBefore = firstParagraph;
+        for (std::size_t i = 0; i < firstParagraphLine; ++i)
+            charsBefore += m_lines[i].length();
+
+        std::size_t charsAfter = m_paragraphLineCounts.size() - 1 - lastParagraph;
+        for (std::size_t i = endLine; i < m_lines.size(); ++i)
+            charsAfter += m_lines[i].length();
+
+        TGUI_ASSERT(charsBefore + charsAfter <= m_text.length(), "Lines outside the changed paragraphs have to match the text");
+
+        std::vector<String> lines;
+        std::vector<float> lineWidths;
+        std::vector<std::size_t> paragraphLineCounts;
+        splitTextIntoLines(m_text.substr(charsBefore, m_text.length() - charsBefore - charsAfter), wordWrapWidth, lines, paragraphLineCounts, lineWidths);
+
+        // The widest line only has to be searched again when it is one of the lines that are being replaced
+        bool widestLineReplaced = false;
+        for (std::size_t i = firstParagraphLine; i < endLine; ++i)
+        {
+            if ((m_lineWidths[i] >= m_maxLineWidth) && (m_maxLineWidth > 0))
+            {
+                widestLineReplaced = true;
+                break;
+            }
+        }
+
+        for (const float lineWidth : lineWidths)
+            m_maxLineWidth = std::max(m_maxLineWidth, lineWidth);
+
+        replaceRange(m_lines, firstParagraphLine, endLine - firstParagraphLine, lines);
+        replaceRange(m_lineWidths, firstParagraphLine, endLine - firstParagraphLine, lineWidths);
+        replaceRange(m_paragraphLineCounts, firstParagraph, lastParagraph - firstParagraph + 1, paragraphLineCounts);
+
+        if (widestLineReplaced)
         {
-            newLinePos = string.find('\n', searchPosStart);
+            m_maxLineWidth = 0;
+            for (const float lineWidth : m_lineWidths)
+                m_maxLineWidth = std::max(m_maxLineWidth, lineWidth);
+        }
 
-            if (newLinePos != String::npos)
-                m_lines.push_back(string.substr(searchPosStart, newLinePos - searchPosStart));
+        finishRearrangeText(selStart, selEnd, keepSelection, emitCaretChangedPosition);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float TextArea::getWordWrapWidth() const
+    {
+        if (m_horizontalScrollbar->getPolicy() != Scrollbar::Policy::Never)
+            return 0;
+
+        // Find the maximum width of one line
+        const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSizeCached);
+        float maxLineWidth = getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight() - 2 * textOffset;
+        if (m_verticalScrollbar->isShown())
+            maxLineWidth -= m_verticalScrollbar->getSize().x;
+
+        if (maxLineWidth <= 0)
+            return -1;
+
+        return maxLineWidth;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextArea::splitTextIntoLines(const String& text, float wordWrapWidth, std::vector<String>& lines,
+                                      std::vector<std::size_t>& paragraphLineCounts, std::vector<float>& lineWidths) const
+    {
+        // Line widths are only needed for the horizontal scrollbar. With a monospaced font, the width only depends on the length.
+        const bool measureLines = (m_horizontalScrollbar->getPolicy() != Scrollbar::Policy::Never);
+        const float monospacedCharWidth = (measureLines && m_monospacedFontOptimizationEnabled) ? m_fontCached.getGlyphAdvance(U'M', m_textSizeCached) : 0;
+
+        const auto addLine = [&](String line)
+        {
+            if (!measureLines)
+                lineWidths.push_back(0);
+            else if (m_monospacedFontOptimizationEnabled)
+                lineWidths.push_back(static_cast<float>(line.length()) * monospacedCharWidth);
             else
-                m_lines.push_back(string.substr(searchPosStart));
+                lineWidths.push_back(Text::getLineWidth(line, m_fontCached, m_textSizeCached));
+
+            lines.push_back(std::move(line));
+        };
+
+        // Word-wrap never combines text from different paragraphs, so each paragraph can be split separately
+        std::size_t paragraphStart = 0;
+        while (true)
+        {
+            const std::size_t paragraphEnd = text.find(U'\n', paragraphStart);
+            String paragraph = text.substr(paragraphStart, (paragraphEnd != String::npos) ? paragraphEnd - paragraphStart : String::npos);
 
-            if (m_horizontalScrollbar->getPolicy() != Scrollbar::Policy::Never)
+            if (wordWrapWidth > 0)
             {
-                if (m_monospacedFontOptimizationEnabled)
-                {
-                    if (m_lines.back().length() > longestLineCharCount)
-                    {
-                        longestLineCharCount = m_lines.back().length();
-                        longestLineIndex = m_lines.size() - 1;
-                    }
-                }
-                else // Not using optimization for monospaced font, so really calculate the width of every line
+                const String wrappedParagraph = Text::wordWrap(wordWrapWidth, paragraph, m_fontCached, m_textSizeCached, false);
+
+                std::size_t lineCount = 0;
+                std::size_t lineStart = 0;
+                std::size_t lineEnd = 0;
+                while (lineEnd != String::npos)
                 {
-                    float lineWidth = Text::getLineWidth(m_lines.back(), m_fontCached, m_textSizeCached);
-                    if (lineWidth > m_maxLineWidth)
-                        m_maxLineWidth = lineWidth;
+                    lineEnd = wrappedParagraph.find(U'\n', lineStart);
+                    addLine(wrappedParagraph.substr(lineStart, (lineEnd != String::npos) ? lineEnd - lineStart : String::npos));
+                    lineStart = lineEnd + 1;
+                    ++lineCount;
                 }
+
+                paragraphLineCounts.push_back(lineCount);
+            }
+            else
+            {
+                addLine(std::move(paragraph));
+                paragraphLineCounts.push_back(1);
             }
 
-            searchPosStart = newLinePos + 1;
+            if (paragraphEnd == String::npos)
+                break;
+
+            paragraphStart = paragraphEnd + 1;
         }
+    }
 
-        if ((m_horizontalScrollbar->getPolicy() != Scrollbar::Policy::Never) && m_monospacedFontOptimizationEnabled)
-            m_maxLineWidth = Text::getLineWidth(m_lines[longestLineIndex], m_fontCached, m_textSizeCached);
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void TextArea::finishRearrangeText(std::size_t selStart, std::size_t selEnd, bool keepSelection, bool emitCaretChangedPosition)
+    {
         // Check if we should try to keep our selection
         if (keepSelection)
         {
@@ -1552,71 +1732,6 @@ namespace tgui
 
     void TextArea::updateSelectionTexts()
     {
-        // If there is no selection then just put the whole text in m_textBeforeSelection
-        if (m_selStart == m_selEnd)
-        {
-            String displayedText;
-            for (const auto& line : m_lines)
-                displayedText += line + U"\n";
-
-            m_textBeforeSelection.setString(displayedText);
-            m_textSelection1.setString(U"");
-            m_textSelection2.setString(U"");
-            m_textAfterSelection1.setString(U"");
-            m_textAfterSelection2.setString(U"");
-        }
-        else // Some text is selected
-        {
-            auto selectionStart = m_selStart;
-            auto selectionEnd = m_selEnd;
-
-            if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
-                std::swap(selectionStart, selectionEnd);
-
-            // Set the text before the selection
-            if (selectionStart.y > 0)
-            {
-                String string;
-                for (std::size_t i = 0; i < selectionStart.y; ++i)
-                    string += m_lines[i] + U"\n";
-
-                string += m_lines[selectionStart.y].substr(0, selectionStart.x);
-                m_textBeforeSelection.setString(string);
-            }
-            else
-                m_textBeforeSelection.setString(m_lines[0].substr(0, selectionStart.x));
-
-            // Set the selected text
-            if (m_selStart.y == m_selEnd.y)
-            {
-                m_textSelection1.setString(m_lines[selectionStart.y].substr(selectionStart.x, selectionEnd.x - selectionStart.x));
-                m_textSelection2.setString(U"");
-            }
-            else
-            {
-                m_textSelection1.setString(m_lines[selectionStart.y].substr(selectionStart.x, m_lines[selectionStart.y].length() - selectionStart.x));
-
-                String string;
-                for (std::size_t i = selectionStart.y + 1; i < selectionEnd.y; ++i)
-                    string += m_lines[i] + U"\n";
-
-                string += m_lines[selectionEnd.y].substr(0, selectionEnd.x);
-
-                m_textSelection2.setString(string);
-            }
-
-            // Set the text after the selection
-            {
-                m_textAfterSelection1.setString(m_lines[selectionEnd.y].substr(selectionEnd.x, m_lines[selectionEnd.y].length() - selectionEnd.x));
-
-                String string;
-                for (std::size_t i = selectionEnd.y + 1; i < m_lines.size(); ++i)
-                    string += m_lines[i] + U"\n";
-
-                m_textAfterSelection2.setString(string);
-            }
-        }
-
         // Check if the caret is located above or below the view
         if (m_verticalScrollbar->getPolicy() != Scrollbar::Policy::Never)
         {
@@ -1719,94 +1834,7 @@ namespace tgui
         if (!m_fontCached)
             return;
 
-        const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSizeCached);
-
-        // Calculate the position of the text objects
-        m_selectionRects.clear();
-        m_textBeforeSelection.setPosition({textOffset, 0});
-        m_defaultText.setPosition({textOffset, 0});
-
-        if (m_selStart != m_selEnd)
-        {
-            auto selectionStart = m_selStart;
-            auto selectionEnd = m_selEnd;
-
-            if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
-                std::swap(selectionStart, selectionEnd);
-
-            float kerningSelectionStart = 0;
-            if ((selectionStart.x > 0) && (selectionStart.x < m_lines[selectionStart.y].length()))
-                kerningSelectionStart = m_fontCached.getKerning(m_lines[selectionStart.y][selectionStart.x-1], m_lines[selectionStart.y][selectionStart.x], m_textSizeCached, false);
-
-            float kerningSelectionEnd = 0;
-            if ((selectionEnd.x > 0) && (selectionEnd.x < m_lines[selectionEnd.y].length()))
-                kerningSelectionEnd = m_fontCached.getKerning(m_lines[selectionEnd.y][selectionEnd.x-1], m_lines[selectionEnd.y][selectionEnd.x], m_textSizeCached, false);
-
-            if (selectionStart.x > 0)
-            {
-                m_textSelection1.setPosition({textOffset + m_textBeforeSelection.findCharacterPos(m_textBeforeSelection.getString().length()).x + kerningSelectionStart,
-                                              m_textBeforeSelection.getPosition().y + (selectionStart.y * m_lineHeight)});
-            }
-            else
-                m_textSelection1.setPosition({textOffset, m_textBeforeSelection.getPosition().y + (selectionStart.y * m_lineHeight)});
-
-            m_textSelection2.setPosition({textOffset, static_cast<float>((selectionStart.y + 1) * m_lineHeight)});
-
-            if (!m_textSelection2.getString().empty() || (selectionEnd.x == 0))
-            {
-                m_textAfterSelection1.setPosition({textOffset + m_textSelection2.findCharacterPos(m_textSelection2.getString().length()).x + kerningSelectionEnd,
-                                                   m_textSelection2.getPosition().y + ((selectionEnd.y - selectionStart.y - 1) * m_lineHeight)});
-            }
-            else
-                m_textAfterSelection1.setPosition({m_textSelection1.getPosition().x + m_textSelection1.findCharacterPos(m_textSelection1.getString().length()).x + kerningSelectionEnd,
-                                                   m_textSelection1.getPosition().y});
-
-            m_textAfterSelection2.setPosition({textOffset, static_cast<float>(selectionEnd.y + 1) * m_lineHeight});
-
-            // Recalculate the selection rectangles
-            {
-                m_selectionRects.emplace_back(m_textSelection1.getPosition().x, static_cast<float>(selectionStart.y) * m_lineHeight, 0.f, m_lineHeight);
-
-                if (!m_lines[selectionStart.y].empty())
-                {
-                    m_selectionRects.back().width = m_textSelection1.findCharacterPos(m_textSelection1.getString().length()).x;
-
-                    // There is kerning when the selection is on just this line
-                    if (selectionStart.y == selectionEnd.y)
-                        m_selectionRects.back().width += kerningSelectionEnd;
-                }
-
-                /// TODO: Implement a way to calculate text size without creating a text object?
-                Text tempText;
-                tempText.setFont(m_fontCached);
-                tempText.setCharacterSize(getTextSize());
-                for (std::size_t i = selectionStart.y + 1; i < selectionEnd.y; ++i)
-                {
-                    m_selectionRects.back().width += textOffset;
-                    m_selectionRects.emplace_back(m_textSelection2.getPosition().x - textOffset, static_cast<float>(i) * m_lineHeight, textOffset, m_lineHeight);
-
-                    if (!m_lines[i].empty())
-                    {
-                        tempText.setString(m_lines[i]);
-                        m_selectionRects.back().width += tempText.findCharacterPos(tempText.getString().length()).x;
-                    }
-                }
-
-                if (selectionStart.y != selectionEnd.y)
-                {
-                    m_selectionRects.back().width += textOffset;
-
-                    if (m_textSelection2.getString() != U"")
-                    {
-                        tempText.setString(m_lines[selectionEnd.y].substr(0, selectionEnd.x));
-                        m_selectionRects.emplace_back(m_textSelection2.getPosition().x - textOffset, static_cast<float>(selectionEnd.y) * m_lineHeight,
-                                                      textOffset + tempText.findCharacterPos(tempText.getString().length()).x + kerningSelectionEnd, m_lineHeight);
-                    }
-                    else
-                        m_selectionRects.emplace_back(0.f, static_cast<float>(selectionEnd.y) * m_lineHeight, textOffset, m_lineHeight);
-                }
-            }
-        }
+        m_defaultText.setPosition({Text::getExtraHorizontalPadding(m_fontCached, m_textSizeCached), 0});
 
         if (m_parentGui)
         {
@@ -1818,6 +1846,8 @@ namespace tgui
             m_parentGui->updateTextCursorPosition(inputRect, getAbsolutePosition({caretPosition.x + m_caretWidthCached, caretPosition.y}));
         }
 
+        // The lines or the selection changed, so the texts have to be rebuilt even if the same lines remain visible
+        m_textWindowOutdated = true;
         recalculateVisibleLines();
     }
 
@@ -1855,6 +1885,162 @@ namespace tgui
 
         if (m_verticalScrollbar->isShown())
             m_verticalScrollbar->setPosition({getSize().x - m_bordersCached.getRight() - m_verticalScrollbar->getSize().x, m_bordersCached.getTop()});
+
+        // Only rebuild the texts when scrolling past the lines that they contain
+        if (m_textWindowOutdated || (m_topLine < m_textWindowFirstLine)
+         || (std::min(m_topLine + m_visibleLines, m_lines.size()) > m_textWindowLastLine))
+        {
+            updateTextWindow();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextArea::updateTextWindow()
+    {
+        if (!m_fontCached)
+            return;
+
+        m_textWindowOutdated = false;
+
+        // Keep one screen of lines above and below the visible lines, so that scrolling doesn't require rebuilding the texts every time
+        const std::size_t margin = std::max<std::size_t>(m_visibleLines, 1);
+        const std::size_t firstLine = (m_topLine > margin) ? (m_topLine - margin) : 0;
+        const std::size_t lastLine = std::min(m_topLine + m_visibleLines + margin, m_lines.size());
+        m_textWindowFirstLine = firstLine;
+        m_textWindowLastLine = lastLine;
+
+        const auto isLineInWindow = [firstLine,lastLine](std::size_t line){ return (line >= firstLine) && (line < lastLine); };
+        const auto joinLines = [this](std::size_t first, std::size_t last){
+            String string;
+            for (std::size_t i = first; i < last; ++i)
+                string += m_lines[i] + U"\n";
+            return string;
+        };
+
+        const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSizeCached);
+        m_selectionRects.clear();
+        m_textBeforeSelection.setPosition({textOffset, static_cast<float>(firstLine) * m_lineHeight});
+
+        // If there is no selection then just put the whole text in m_textBeforeSelection
+        if (m_selStart == m_selEnd)
+        {
+            m_textBeforeSelection.setString(joinLines(firstLine, lastLine));
+            m_textSelection1.setString(U"");
+            m_textSelection2.setString(U"");
+            m_textAfterSelection1.setString(U"");
+            m_textAfterSelection2.setString(U"");
+            return;
+        }
+
+        auto selectionStart = m_selStart;
+        auto selectionEnd = m_selEnd;
+
+        if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
+            std::swap(selectionStart, selectionEnd);
+
+        // Set the text before the selection
+        {
+            String string = joinLines(firstLine, std::min(selectionStart.y, lastLine));
+            if (isLineInWindow(selectionStart.y))
+                string += m_lines[selectionStart.y].substr(0, selectionStart.x);
+
+            m_textBeforeSelection.setString(string);
+        }
+
+        // Set the selected text
+        if (!isLineInWindow(selectionStart.y))
+            m_textSelection1.setString(U"");
+        else if (selectionStart.y == selectionEnd.y)
+            m_textSelection1.setString(m_lines[selectionStart.y].substr(selectionStart.x, selectionEnd.x - selectionStart.x));
+        else
+            m_textSelection1.setString(m_lines[selectionStart.y].substr(selectionStart.x, m_lines[selectionStart.y].length() - selectionStart.x));
+
+        const std::size_t selection2FirstLine = std::max(selectionStart.y + 1, firstLine);
+        if (selectionStart.y == selectionEnd.y)
+            m_textSelection2.setString(U"");
+        else
+        {
+            String string = joinLines(selection2FirstLine, std::max(selection2FirstLine, std::min(selectionEnd.y, lastLine)));
+            if (isLineInWindow(selectionEnd.y))
+                string += m_lines[selectionEnd.y].substr(0, selectionEnd.x);
+
+            m_textSelection2.setString(string);
+        }
+
+        // Set the text after the selection
+        const std::size_t afterSelection2FirstLine = std::max(selectionEnd.y + 1, firstLine);
+        if (isLineInWindow(selectionEnd.y))
+            m_textAfterSelection1.setString(m_lines[selectionEnd.y].substr(selectionEnd.x, m_lines[selectionEnd.y].length() - selectionEnd.x));
+        else
+            m_textAfterSelection1.setString(U"");
+
+        m_textAfterSelection2.setString(joinLines(afterSelection2FirstLine, std::max(afterSelection2FirstLine, lastLine)));
+
+        // Calculate the position of the text objects
+        float kerningSelectionStart = 0;
+        if ((selectionStart.x > 0) && (selectionStart.x < m_lines[selectionStart.y].length()))
+            kerningSelectionStart = m_fontCached.getKerning(m_lines[selectionStart.y][selectionStart.x-1], m_lines[selectionStart.y][selectionStart.x], m_textSizeCached, false);
+
+        float kerningSelectionEnd = 0;
+        if ((selectionEnd.x > 0) && (selectionEnd.x < m_lines[selectionEnd.y].length()))
+            kerningSelectionEnd = m_fontCached.getKerning(m_lines[selectionEnd.y][selectionEnd.x-1], m_lines[selectionEnd.y][selectionEnd.x], m_textSizeCached, false);
+
+        if ((selectionStart.x > 0) && isLineInWindow(selectionStart.y))
+        {
+            m_textSelection1.setPosition({textOffset + m_textBeforeSelection.findCharacterPos(m_textBeforeSelection.getString().length()).x + kerningSelectionStart,
+                                          static_cast<float>(selectionStart.y) * m_lineHeight});
+        }
+        else
+            m_textSelection1.setPosition({textOffset, static_cast<float>(selectionStart.y) * m_lineHeight});
+
+        m_textSelection2.setPosition({textOffset, static_cast<float>(selection2FirstLine) * m_lineHeight});
+
+        if (selectionStart.y != selectionEnd.y)
+        {
+            m_textAfterSelection1.setPosition({textOffset + m_textSelection2.findCharacterPos(m_textSelection2.getString().length()).x + kerningSelectionEnd,
+                                               static_cast<float>(selectionEnd.y) * m_lineHeight});
+        }
+        else
+            m_textAfterSelection1.setPosition({m_textSelection1.getPosition().x + m_textSelection1.findCharacterPos(m_textSelection1.getString().length()).x + kerningSelectionEnd,
+                                               m_textSelection1.getPosition().y});
+
+        m_textAfterSelection2.setPosition({textOffset, static_cast<float>(afterSelection2FirstLine) * m_lineHeight});
+
+        // Recalculate the selection rectangles of the lines inside the window
+        if (isLineInWindow(selectionStart.y))
+        {
+            float width = m_textSelection1.findCharacterPos(m_textSelection1.getString().length()).x;
+            if (selectionStart.y == selectionEnd.y)
+                width += kerningSelectionEnd; // There is kerning when the selection is on just this line
+            else
+                width += textOffset;
+
+            m_selectionRects.emplace_back(m_textSelection1.getPosition().x, static_cast<float>(selectionStart.y) * m_lineHeight, width, m_lineHeight);
+        }
+
+        /// TODO: Implement a way to calculate text size without creating a text object?
+        Text tempText;
+        tempText.setFont(m_fontCached);
+        tempText.setCharacterSize(getTextSize());
+        for (std::size_t i = selection2FirstLine; i < std::min(selectionEnd.y, lastLine); ++i)
+        {
+            float width = 2 * textOffset;
+            if (!m_lines[i].empty())
+            {
+                tempText.setString(m_lines[i]);
+                width += tempText.findCharacterPos(tempText.getString().length()).x;
+            }
+
+            m_selectionRects.emplace_back(0.f, static_cast<float>(i) * m_lineHeight, width, m_lineHeight);
+        }
+
+        if ((selectionStart.y != selectionEnd.y) && isLineInWindow(selectionEnd.y))
+        {
+            tempText.setString(m_lines[selectionEnd.y].substr(0, selectionEnd.x));
+            m_selectionRects.emplace_back(0.f, static_cast<float>(selectionEnd.y) * m_lineHeight,
+                                          textOffset + tempText.findCharacterPos(tempText.getString().length()).x + kerningSelectionEnd, m_lineHeight);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
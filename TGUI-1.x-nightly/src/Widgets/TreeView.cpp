@@ -28,6 +28,7 @@
 #include <cassert>
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <cmath>
+    #include <algorithm>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -76,8 +77,10 @@ namespace tgui
         {
             auto newNode = std::make_shared<TreeView::Node>();
             newNode->text = oldNode->text;
+            newNode->id = oldNode->id;
             newNode->depth = oldNode->depth;
             newNode->expanded = oldNode->expanded;
+            newNode->childrenPending = oldNode->childrenPending;
             newNode->parent = parent;
 
             for (const auto& oldChild : oldNode->nodes)
@@ -88,23 +91,18 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        void cloneVisibleNodeList(const std::vector<std::shared_ptr<TreeView::Node>>& oldNodes,
-                                  std::vector<std::shared_ptr<TreeView::Node>>& newNodes,
-                                  const std::vector<std::shared_ptr<TreeView::Node>>& oldList,
+        void cloneVisibleNodeList(const std::vector<std::shared_ptr<TreeView::Node>>& newNodes,
+                                  const std::unordered_map<std::size_t, std::size_t>& visibleIndexById,
                                   std::vector<std::shared_ptr<TreeView::Node>>& newList)
         {
-            TGUI_ASSERT(oldNodes.size() == newNodes.size(), "Nodes must have been allocated before calling cloneVisibleNodeList");
-            TGUI_ASSERT(oldList.size() == newList.size(), "Nodes must have been allocated before calling cloneVisibleNodeList");
-
-            for (unsigned int i = 0; i < oldNodes.size(); ++i)
+            // The cloned nodes have the same ids as the original ones, so they end up at the same rows
+            for (const auto& node : newNodes)
             {
-                for (unsigned int j = 0; j < oldList.size(); ++j)
-                {
-                    if (oldNodes[i] == oldList[j])
-                        newList[j] = newNodes[i];
-                }
+                const auto it = visibleIndexById.find(node->id);
+                if (it != visibleIndexById.end())
+                    newList[it->second] = node;
 
-                cloneVisibleNodeList(oldNodes[i]->nodes, newNodes[i]->nodes, oldList, newList);
+                cloneVisibleNodeList(node->nodes, visibleIndexById, newList);
             }
         }
 
@@ -124,7 +122,63 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        bool removeItemImpl(const std::vector<String>& hierarchy, bool removeParentsWhenEmpty, unsigned int parentIndex, std::vector<std::shared_ptr<TreeView::Node>>& nodes)
+        void registerNodeIds(std::unordered_map<std::size_t, TreeView::Node*>& nodesById, const std::vector<std::shared_ptr<TreeView::Node>>& nodes)
+        {
+            for (const auto& node : nodes)
+            {
+                nodesById[node->id] = node.get();
+                registerNodeIds(nodesById, node->nodes);
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void unregisterNodeIds(std::unordered_map<std::size_t, TreeView::Node*>& nodesById, const TreeView::Node& node)
+        {
+            nodesById.erase(node.id);
+            for (const auto& child : node.nodes)
+                unregisterNodeIds(nodesById, *child);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool isBranchNode(const TreeView::Node& node)
+        {
+            // A node with pending children is shown as a collapsed branch until it is expanded and its children are loaded
+            return !node.nodes.empty() || node.childrenPending;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::vector<String> getNodeHierarchy(const TreeView::Node* node)
+        {
+            std::vector<String> hierarchy;
+            while (node)
+            {
+                hierarchy.push_back(node->text.getString());
+                node = node->parent;
+            }
+
+            std::reverse(hierarchy.begin(), hierarchy.end());
+            return hierarchy;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void collectVisibleNodes(const std::vector<std::shared_ptr<TreeView::Node>>& nodes, std::vector<std::shared_ptr<TreeView::Node>>& visibleNodes)
+        {
+            for (const auto& node : nodes)
+            {
+                visibleNodes.push_back(node);
+                if (node->expanded && !node->nodes.empty())
+                    collectVisibleNodes(node->nodes, visibleNodes);
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool removeItemImpl(const std::vector<String>& hierarchy, bool removeParentsWhenEmpty, unsigned int parentIndex,
+                            std::vector<std::shared_ptr<TreeView::Node>>& nodes, std::unordered_map<std::size_t, TreeView::Node*>& nodesById)
         {
             for (auto it = nodes.begin(); it != nodes.end(); ++it)
             {
@@ -133,13 +187,14 @@ namespace tgui
 
                 if (parentIndex + 1 == hierarchy.size())
                 {
+                    unregisterNodeIds(nodesById, **it);
                     nodes.erase(it);
                     return true;
                 }
                 else
                 {
                     // Return false if some menu in the hierarchy couldn't be found
-                    if (!removeItemImpl(hierarchy, removeParentsWhenEmpty, parentIndex + 1, (*it)->nodes))
+                    if (!removeItemImpl(hierarchy, removeParentsWhenEmpty, parentIndex + 1, (*it)->nodes, nodesById))
                         return false;
 
                     // If parents don't have to be removed as well then we are done
@@ -148,7 +203,10 @@ namespace tgui
 
                     // Also delete the parent if empty
                     if ((*it)->nodes.empty())
+                    {
+                        unregisterNodeIds(nodesById, **it);
                         nodes.erase(it);
+                    }
 
                     return true;
                 }
@@ -166,6 +224,7 @@ namespace tgui
             for (const auto& node : nodes)
             {
                 TreeView::ConstNode constNode;
+                constNode.id = node->id;
                 constNode.expanded = node->expanded;
                 constNode.text = node->text.getString();
                 constNode.nodes = convertNodesToConstNodes(node->nodes);
@@ -267,6 +326,8 @@ namespace tgui
         onExpand                            {other.onExpand},
         onCollapse                          {other.onCollapse},
         onRightClick                        {other.onRightClick},
+        m_nextNodeId                        {other.m_nextNodeId},
+        m_childrenLoader                    {other.m_childrenLoader},
         m_selectedItem                      {other.m_selectedItem},
         m_hoveredItem                       {other.m_hoveredItem},
         m_itemHeight                        {other.m_itemHeight},
@@ -293,8 +354,11 @@ namespace tgui
         for (const auto& node : other.m_nodes)
             m_nodes.push_back(cloneNode(node, nullptr));
 
+        registerNodeIds(m_nodesById, m_nodes);
+
+        m_visibleIndexById = other.m_visibleIndexById;
         m_visibleNodes.resize(other.m_visibleNodes.size(), nullptr);
-        cloneVisibleNodeList(other.m_nodes, m_nodes, other.m_visibleNodes, m_visibleNodes);
+        cloneVisibleNodeList(m_nodes, m_visibleIndexById, m_visibleNodes);
 
         TGUI_ASSERT(std::count(m_visibleNodes.begin(), m_visibleNodes.end(), nullptr) == 0, "Cloned nodes can't contain a nullptr");
     }
@@ -316,6 +380,10 @@ namespace tgui
             std::swap(onRightClick,                         temp.onRightClick);
             std::swap(m_nodes,                              temp.m_nodes);
             std::swap(m_visibleNodes,                       temp.m_visibleNodes);
+            std::swap(m_visibleIndexById,                   temp.m_visibleIndexById);
+            std::swap(m_nodesById,                          temp.m_nodesById);
+            std::swap(m_nextNodeId,                         temp.m_nextNodeId);
+            std::swap(m_childrenLoader,                     temp.m_childrenLoader);
             std::swap(m_selectedItem,                       temp.m_selectedItem);
             std::swap(m_hoveredItem,                        temp.m_hoveredItem);
             std::swap(m_itemHeight,                         temp.m_itemHeight);
@@ -481,16 +549,12 @@ namespace tgui
         if (!node)
             return false;
 
-        for (std::size_t i = 0; i < m_visibleNodes.size(); ++i)
-        {
-            if (m_visibleNodes[i].get() == node)
-            {
-                updateSelectedItem(static_cast<int>(i));
-                return true;
-            }
-        }
+        const int index = findVisibleNodeIndex(node);
+        if (index < 0)
+            return false;
 
-        return false;
+        updateSelectedItem(index);
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -504,7 +568,7 @@ namespace tgui
 
     bool TreeView::removeItem(const std::vector<String>& hierarchy, bool removeParentsWhenEmpty)
     {
-        const bool ret = removeItemImpl(hierarchy, removeParentsWhenEmpty, 0, m_nodes);
+        const bool ret = removeItemImpl(hierarchy, removeParentsWhenEmpty, 0, m_nodes, m_nodesById);
         markNodesDirty();
         return ret;
     }
@@ -514,11 +578,193 @@ namespace tgui
     void TreeView::removeAllItems()
     {
         m_nodes.clear();
+        m_nodesById.clear();
         markNodesDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::size_t TreeView::addChildItem(std::size_t parentId, const String& text, bool childrenPending)
+    {
+        Node* parent = nullptr;
+        if (parentId != 0)
+        {
+            const auto it = m_nodesById.find(parentId);
+            if (it == m_nodesById.end())
+                return 0;
+
+            parent = it->second;
+        }
+
+        auto& siblings = parent ? parent->nodes : m_nodes;
+        createNode(siblings, parent, text);
+
+        const auto& node = siblings.back();
+        if (childrenPending)
+        {
+            node->expanded = false;
+            node->childrenPending = true;
+        }
+
+        // Only insert the new row when the item is visible, items added to collapsed nodes don't require any further work
+        if (!parent)
+            insertVisibleNodes(m_visibleNodes.size(), {node}, positionNodeText(*node, Text::getExtraHorizontalPadding(m_fontCached, m_textSizeCached)));
+        else if (parent->expanded)
+        {
+            const int parentIndex = findVisibleNodeIndex(parent);
+            if (parentIndex >= 0)
+            {
+                // The new item is placed after the last visible descendant of its parent
+                auto index = static_cast<std::size_t>(parentIndex) + 1;
+                while ((index < m_visibleNodes.size()) && (m_visibleNodes[index]->depth > parent->depth))
+                    ++index;
+
+                insertVisibleNodes(index, {node}, positionNodeText(*node, Text::getExtraHorizontalPadding(m_fontCached, m_textSizeCached)));
+            }
+        }
+
+        return node->id;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::setChildrenLoader(ChildrenLoader loader)
+    {
+        m_childrenLoader = std::move(loader);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TreeView::setItemChildrenPending(std::size_t id, bool childrenPending)
+    {
+        const auto it = m_nodesById.find(id);
+        if (it == m_nodesById.end())
+            return false;
+
+        Node* node = it->second;
+        if (childrenPending)
+        {
+            setNodeExpanded(node, false);
+
+            for (const auto& child : node->nodes)
+                unregisterNodeIds(m_nodesById, *child);
+            node->nodes.clear();
+        }
+
+        node->childrenPending = childrenPending;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TreeView::getItemId(const std::vector<String>& hierarchy) const
+    {
+        if (hierarchy.empty())
+            return 0;
+
+        const auto* node = findNode(m_nodes, hierarchy, 0);
+        return node ? node->id : 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<String> TreeView::getItemHierarchy(std::size_t id) const
+    {
+        const auto it = m_nodesById.find(id);
+        if (it == m_nodesById.end())
+            return {};
+
+        return getNodeHierarchy(it->second);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TreeView::getSelectedItemId() const
+    {
+        if (m_selectedItem < 0)
+            return 0;
+
+        return m_visibleNodes[static_cast<std::size_t>(m_selectedItem)]->id;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TreeView::expandItemById(std::size_t id)
+    {
+        const auto it = m_nodesById.find(id);
+        if (it == m_nodesById.end())
+            return false;
+
+        // Expand the node before its parents, so that its children are inserted together with the rest of the subtree
+        for (Node* node = it->second; node; node = node->parent)
+            setNodeExpanded(node, true);
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TreeView::collapseItemById(std::size_t id)
+    {
+        const auto it = m_nodesById.find(id);
+        if (it == m_nodesById.end())
+            return false;
+
+        setNodeExpanded(it->second, false);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TreeView::selectItemById(std::size_t id)
+    {
+        const auto it = m_nodesById.find(id);
+        if (it == m_nodesById.end())
+            return false;
+
+        // Make sure the parents of the item are expanded
+        for (Node* parent = it->second->parent; parent; parent = parent->parent)
+            setNodeExpanded(parent, true);
+
+        const int index = findVisibleNodeIndex(it->second);
+        if (index < 0)
+            return false;
+
+        updateSelectedItem(index);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TreeView::removeItemById(std::size_t id)
+    {
+        const auto it = m_nodesById.find(id);
+        if (it == m_nodesById.end())
+            return false;
+
+        Node* node = it->second;
+        const int index = findVisibleNodeIndex(node);
+        if (index >= 0)
+        {
+            // Remove the row of the node together with the rows of its visible descendants
+            auto end = static_cast<std::size_t>(index) + 1;
+            while ((end < m_visibleNodes.size()) && (m_visibleNodes[end]->depth > node->depth))
+                ++end;
+
+            eraseVisibleNodes(static_cast<std::size_t>(index), end - static_cast<std::size_t>(index));
+        }
+
+        auto& siblings = node->parent ? node->parent->nodes : m_nodes;
+        const auto nodeIt = std::find_if(siblings.begin(), siblings.end(), [node](const std::shared_ptr<Node>& child){ return child.get() == node; });
+        assert(nodeIt != siblings.end());
+
+        unregisterNodeIds(m_nodesById, *node);
+        siblings.erase(nodeIt);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     std::vector<String> TreeView::getSelectedItem() const
     {
         std::vector<String> hierarchy;
@@ -679,25 +925,18 @@ namespace tgui
         if (index >= m_visibleNodes.size())
             return;
 
-        if (m_visibleNodes[index]->nodes.empty())
+        if (!isBranchNode(*m_visibleNodes[index]))
             return;
 
-        std::vector<String> hierarchy;
-        auto* node = m_visibleNodes[index].get();
-        assert(node != nullptr);
-        while (node)
-        {
-            hierarchy.insert(hierarchy.begin(), node->text.getString());
-            node = node->parent;
-        }
+        // Keep the node alive, the children loader could remove it from the tree
+        const auto node = m_visibleNodes[index];
+        const std::vector<String> hierarchy = getNodeHierarchy(node.get());
 
-        m_visibleNodes[index]->expanded = !m_visibleNodes[index]->expanded;
-        if (m_visibleNodes[index]->expanded)
+        setNodeExpanded(node.get(), !node->expanded);
+        if (node->expanded)
             onExpand.emit(this, hierarchy.back(), hierarchy);
         else
             onCollapse.emit(this, hierarchy.back(), hierarchy);
-
-        markNodesDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -742,6 +981,7 @@ namespace tgui
         if (!node)
             return constNode;
 
+        constNode.id = node->id;
         constNode.expanded = node->expanded;
         constNode.text = node->text.getString();
         constNode.nodes = convertNodesToConstNodes(node->nodes);
@@ -1107,21 +1347,13 @@ namespace tgui
         {
             // If item is an expanded node then collapse it. Otherwise select the parent node, or the previous sibling node if it has no parent.
             TGUI_ASSERT(selectedItemIdx <= m_visibleNodes.size(), "Selected item index has to be in range");
-            if (!m_visibleNodes[selectedItemIdx]->nodes.empty() && m_visibleNodes[selectedItemIdx]->expanded)
-            {
-                m_visibleNodes[selectedItemIdx]->expanded = false;
-                markNodesDirty();
-            }
+            if (isBranchNode(*m_visibleNodes[selectedItemIdx]) && m_visibleNodes[selectedItemIdx]->expanded)
+                setNodeExpanded(m_visibleNodes[selectedItemIdx].get(), false);
             else if (m_visibleNodes[selectedItemIdx]->parent)
             {
-                for (std::size_t i = 0; i < m_visibleNodes.size(); ++i)
-                {
-                    if (m_visibleNodes[i].get() == m_visibleNodes[selectedItemIdx]->parent)
-                    {
-                        updateSelectedItem(static_cast<int>(i));
-                        break;
-                    }
-                }
+                const int parentIndex = findVisibleNodeIndex(m_visibleNodes[selectedItemIdx]->parent);
+                if (parentIndex >= 0)
+                    updateSelectedItem(parentIndex);
             }
             else if (m_selectedItem > 0)
             {
@@ -1136,25 +1368,17 @@ namespace tgui
                 }
 
                 TGUI_ASSERT(nodeIndex > 0, "Index can't be 0 as this is not the top item");
-                for (std::size_t i = 0; i < m_visibleNodes.size(); ++i)
-                {
-                    if (m_visibleNodes[i] == m_nodes[nodeIndex - 1])
-                    {
-                        updateSelectedItem(static_cast<int>(i));
-                        break;
-                    }
-                }
+                const int siblingIndex = findVisibleNodeIndex(m_nodes[nodeIndex - 1].get());
+                if (siblingIndex >= 0)
+                    updateSelectedItem(siblingIndex);
             }
         }
         else if (event.code == Event::KeyboardKey::Right)
         {
             // If item is a collapsed node then expand it. Otherwise simply select the next item.
             TGUI_ASSERT(selectedItemIdx <= m_visibleNodes.size(), "Selected item index has to be in range");
-            if (!m_visibleNodes[selectedItemIdx]->nodes.empty() && !m_visibleNodes[selectedItemIdx]->expanded)
-            {
-                m_visibleNodes[selectedItemIdx]->expanded = true;
-                markNodesDirty();
-            }
+            if (isBranchNode(*m_visibleNodes[selectedItemIdx]) && !m_visibleNodes[selectedItemIdx]->expanded)
+                setNodeExpanded(m_visibleNodes[selectedItemIdx].get(), true);
             else if (selectedItemIdx + 1 < m_visibleNodes.size())
                 updateSelectedItem(m_selectedItem + 1);
         }
@@ -1403,16 +1627,12 @@ namespace tgui
     {
         for (auto& node : nodes)
         {
+            m_visibleIndexById[node->id] = m_visibleNodes.size();
             m_visibleNodes.push_back(node);
             if (selectedNode == node.get())
                 m_selectedItem = static_cast<int>(pos);
 
-            const float iconPadding = (m_iconBounds.x / 4.f);
-            const float iconOffset = iconPadding + ((m_iconBounds.x + iconPadding) * node->depth);
-            node->text.setPosition({iconOffset + m_iconBounds.x + iconPadding + textPadding,
-                                    (pos * m_itemHeight) + ((m_itemHeight - node->text.getSize().y) / 2.f)});
-
-            const float right = node->text.getPosition().x + node->text.getSize().x + m_paddingCached.getRight();
+            const float right = positionNodeText(*node, textPadding);
             if (right > m_maxRight)
                 m_maxRight = right;
 
@@ -1426,6 +1646,18 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    float TreeView::positionNodeText(Node& node, float textPadding)
+    {
+        // The vertical position is relative to the row, so that the text doesn't have to move when rows are inserted above it
+        const float iconPadding = (m_iconBounds.x / 4.f);
+        const float iconOffset = iconPadding + ((m_iconBounds.x + iconPadding) * node.depth);
+        node.text.setPosition({iconOffset + m_iconBounds.x + iconPadding + textPadding, (m_itemHeight - node.text.getSize().y) / 2.f});
+
+        return node.text.getPosition().x + node.text.getSize().x + m_paddingCached.getRight();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TreeView::markNodesDirty()
     {
         Node* selectedNode = nullptr;
@@ -1438,6 +1670,7 @@ namespace tgui
         m_hoveredItem = -1;
         m_selectedItem = -1;
         m_visibleNodes.clear();
+        m_visibleIndexById.clear();
         updateVisibleNodes(m_nodes, selectedNode, Text::getExtraHorizontalPadding(m_fontCached, m_textSizeCached), 0);
 
         if (oldHoveredItem >= 0)
@@ -1449,6 +1682,13 @@ namespace tgui
             updateSelectedAndHoveringItemColors();
         }
 
+        updateScrollbars();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::updateScrollbars()
+    {
         m_verticalScrollbar->setMaximum(static_cast<unsigned int>(m_itemHeight * m_visibleNodes.size()));
         m_horizontalScrollbar->setMaximum(static_cast<unsigned int>(m_maxRight));
 
@@ -1555,7 +1795,7 @@ namespace tgui
             statesForIcon.transform.translate({std::round(iconOffset), std::round((i * m_itemHeight) + ((m_itemHeight - m_iconBounds.y) / 2.f))});
 
             // Draw an icon for the leaf node if a texture is set
-            if (m_visibleNodes[i]->nodes.empty())
+            if (!isBranchNode(*m_visibleNodes[i]))
             {
                 if (m_spriteLeaf.isSet())
                     target.drawSprite(statesForIcon, m_spriteLeaf);
@@ -1623,7 +1863,11 @@ namespace tgui
 
         // Draw the texts
         for (std::size_t i = firstNode; i < lastNode; ++i)
-            target.drawText(states, m_visibleNodes[i]->text);
+        {
+            auto statesForText = states;
+            statesForText.transform.translate({0, static_cast<float>(i * m_itemHeight)});
+            target.drawText(statesForText, m_visibleNodes[i]->text);
+        }
 
         target.removeClippingLayer();
 
@@ -1641,8 +1885,10 @@ namespace tgui
         newNode->text.setOpacity(m_opacityCached);
         newNode->text.setCharacterSize(m_textSizeCached);
         newNode->text.setString(text);
+        newNode->id = m_nextNodeId++;
         newNode->expanded = true;
         newNode->parent = parent;
+        m_nodesById[newNode->id] = newNode.get();
 
         if (parent)
             newNode->depth = parent->depth + 1;
@@ -1659,60 +1905,179 @@ namespace tgui
         if (hierarchy.empty())
             return false;
 
-        if (hierarchy.size() >= 2)
+        auto* node = findNode(m_nodes, hierarchy, 0);
+        if (!node)
+            return false;
+
+        if (expandNode)
         {
-            auto* node = findNode(m_nodes, hierarchy, 0);
-            if (!node)
-                return false;
+            // When expanding, also expand all parents
+            for (auto* nodeToExpand = node; nodeToExpand; nodeToExpand = nodeToExpand->parent)
+                setNodeExpanded(nodeToExpand, true);
+        }
+        else // Collapsing
+            setNodeExpanded(node, false);
 
-            bool nodeChanged = false;
-            if (expandNode)
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TreeView::setNodeExpanded(Node* node, bool expand)
+    {
+        if (node->expanded == expand)
+            return false;
+
+        if (!expand)
+        {
+            node->expanded = false;
+
+            // The visible children of the node are the rows below it that have a larger depth
+            const int index = findVisibleNodeIndex(node);
+            if (index >= 0)
             {
-                // When expanding, also expand all parents
-                auto* nodeToExpand = node;
-                while (nodeToExpand)
-                {
-                    if (nodeToExpand->expanded != expandNode)
-                    {
-                        nodeToExpand->expanded = expandNode;
-                        nodeChanged = true;
-                    }
+                const auto first = static_cast<std::size_t>(index) + 1;
+                auto last = first;
+                while ((last < m_visibleNodes.size()) && (m_visibleNodes[last]->depth > node->depth))
+                    ++last;
 
-                    nodeToExpand = nodeToExpand->parent;
-                }
+                eraseVisibleNodes(first, last - first);
             }
-            else // Collapsing
+
+            return true;
+        }
+
+        if (node->childrenPending)
+        {
+            node->childrenPending = false;
+            if (m_childrenLoader)
             {
-                if (node->expanded != expandNode)
-                {
-                    node->expanded = expandNode;
-                    nodeChanged = true;
-                }
+                // The node is still collapsed while loading, so adding the children doesn't change the visible nodes yet
+                const std::size_t id = node->id;
+                m_childrenLoader(id);
+
+                const auto it = m_nodesById.find(id);
+                if (it == m_nodesById.end())
+                    return true;
+
+                node = it->second;
             }
+        }
 
-            if (nodeChanged)
-                markNodesDirty();
+        node->expanded = true;
 
-            return true;
+        const int index = findVisibleNodeIndex(node);
+        if ((index >= 0) && !node->nodes.empty())
+        {
+            std::vector<std::shared_ptr<Node>> newVisibleNodes;
+            collectVisibleNodes(node->nodes, newVisibleNodes);
+
+            float maxRight = 0;
+            const float textPadding = Text::getExtraHorizontalPadding(m_fontCached, m_textSizeCached);
+            for (const auto& newVisibleNode : newVisibleNodes)
+                maxRight = std::max(maxRight, positionNodeText(*newVisibleNode, textPadding));
+
+            insertVisibleNodes(static_cast<std::size_t>(index) + 1, newVisibleNodes, maxRight);
         }
-        else // Root node
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int TreeView::findVisibleNodeIndex(const Node* node) const
+    {
+        const auto it = m_visibleIndexById.find(node->id);
+        if (it == m_visibleIndexById.end())
+            return -1;
+
+        TGUI_ASSERT(m_visibleNodes[it->second].get() == node, "Visible node indices have to be kept in sync with the visible nodes");
+        return static_cast<int>(it->second);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::insertVisibleNodes(std::size_t index, const std::vector<std::shared_ptr<Node>>& nodes, float maxRight)
+    {
+        if (nodes.empty())
+            return;
+
+        m_visibleNodes.insert(m_visibleNodes.begin() + static_cast<std::ptrdiff_t>(index), nodes.begin(), nodes.end());
+        updateVisibleNodeIndices(index);
+
+        // The selected and hovered items keep pointing to the same node
+        const int count = static_cast<int>(nodes.size());
+        if (m_selectedItem >= static_cast<int>(index))
+            m_selectedItem += count;
+        if (m_hoveredItem >= static_cast<int>(index))
+            m_hoveredItem += count;
+
+        if (maxRight > m_maxRight)
+            m_maxRight = maxRight;
+
+        updateScrollbars();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::eraseVisibleNodes(std::size_t index, std::size_t count)
+    {
+        if (count == 0)
+            return;
+
+        const int first = static_cast<int>(index);
+        const int last = static_cast<int>(index + count);
+        if ((m_selectedItem >= first) && (m_selectedItem < last))
         {
-            for (const auto& node : m_nodes)
-            {
-                if (node->text.getString() != hierarchy.back())
-                    continue;
+            m_visibleNodes[static_cast<std::size_t>(m_selectedItem)]->text.setColor(m_textColorCached);
+            m_selectedItem = -1;
+        }
+        else if (m_selectedItem >= last)
+            m_selectedItem -= static_cast<int>(count);
 
-                if (node->expanded != expandNode)
-                {
-                    node->expanded = expandNode;
-                    markNodesDirty();
-                }
+        if ((m_hoveredItem >= first) && (m_hoveredItem < last))
+        {
+            m_visibleNodes[static_cast<std::size_t>(m_hoveredItem)]->text.setColor(m_textColorCached);
+            m_hoveredItem = -1;
+        }
+        else if (m_hoveredItem >= last)
+            m_hoveredItem -= static_cast<int>(count);
 
-                return true;
+        // The width only has to be recalculated when the widest node is being removed
+        bool widestNodeRemoved = false;
+        for (std::size_t i = index; i < index + count; ++i)
+        {
+            const auto& text = m_visibleNodes[i]->text;
+            if (text.getPosition().x + text.getSize().x + m_paddingCached.getRight() >= m_maxRight)
+            {
+                widestNodeRemoved = true;
+                break;
             }
         }
 
-        return false;
+        for (std::size_t i = index; i < index + count; ++i)
+            m_visibleIndexById.erase(m_visibleNodes[i]->id);
+
+        m_visibleNodes.erase(m_visibleNodes.begin() + static_cast<std::ptrdiff_t>(index), m_visibleNodes.begin() + static_cast<std::ptrdiff_t>(index + count));
+        updateVisibleNodeIndices(index);
+
+        if (widestNodeRemoved)
+        {
+            m_maxRight = 0;
+            for (const auto& node : m_visibleNodes)
+                m_maxRight = std::max(m_maxRight, node->text.getPosition().x + node->text.getSize().x + m_paddingCached.getRight());
+        }
+
+        updateScrollbars();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::updateVisibleNodeIndices(std::size_t first)
+    {
+        // Only the rows below the inserted or erased rows changed position
+        for (std::size_t i = first; i < m_visibleNodes.size(); ++i)
+            m_visibleIndexById[m_visibleNodes[i]->id] = i;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////